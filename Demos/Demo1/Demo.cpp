@@ -1,4 +1,6 @@
 #include <format>
+#include <optional>
+#include <span>
 
 #include <Miracle/Miracle.hpp>
 
@@ -8,11 +10,13 @@ static void updateTitle() {
 	Window::setTitle(
 		UnicodeConverter::toUtf8(
 			std::format(
-				"{} - FPS: {} - UPS: {} - Entity count: {}",
+				"{} - FPS: {} - UPS: {} - Entity count: {} - Drawn: {} - Culled: {}",
 				CurrentApp::getName(),
 				PerformanceCounters::getFps(),
 				PerformanceCounters::getUps(),
-				CurrentScene::getEntityCount()
+				CurrentScene::getEntityCount(),
+				PerformanceCounters::getDrawnEntityCount(),
+				PerformanceCounters::getCulledEntityCount()
 			)
 		)
 	);
@@ -45,6 +49,8 @@ class PlayerBehavior : public BehaviorBase {
 private:
 	float m_movementSpeed;
 	Degrees m_turnSpeed;
+	std::optional<PrefabId> m_projectilePrefabId = {};
+	bool m_shieldCreated = false;
 
 public:
 	PlayerBehavior(
@@ -57,6 +63,8 @@ public:
 	{}
 	
 	virtual void act() override {
+		MIRACLE_TRACE_ZONE("PlayerBehavior::act");
+
 		auto velocity = Vector3{
 			.x = static_cast<float>(Keyboard::isKeyHeld(KeyboardKey::keyD) - Keyboard::isKeyHeld(KeyboardKey::keyA)),
 			.y = static_cast<float>(Keyboard::isKeyHeld(KeyboardKey::keyW) - Keyboard::isKeyHeld(KeyboardKey::keyS))
@@ -69,19 +77,45 @@ public:
 		transform.rotate(Quaternion::createRotation(Vector3s::forward, rotation * m_turnSpeed * DeltaTime::get()));
 		transform.translate(velocity.toNormalized() * m_movementSpeed * DeltaTime::get());
 
-		if (Keyboard::isKeyPressed(KeyboardKey::keySpace)) {
-			CurrentScene::createEntity(
+		// The shield follows the player through the transform hierarchy
+		if (!m_shieldCreated) {
+			auto shield = CurrentScene::createAndGetEntity(
 				EntityConfig{
 					.transformConfig = TransformConfig{
-						.translation = transform.getTranslation(),
-						.rotation    = transform.getRotation(),
-						.scale       = Vector3{ .x = 0.5f, .y = 0.5f, .z = 1.0f }
+						.translation = Vector3{ .y = 0.75f },
+						.scale       = Vector3{ .x = 1.0f, .y = 0.25f, .z = 1.0f }
 					},
 					.appearanceConfig = AppearanceConfig{
-						.meshIndex = 1,
-						.color     = ColorRgbs::magenta
-					},
-					.behaviorFactory = BehaviorFactory::createFactoryFor<ProjectileBehavior>(3.0f)
+						.meshIndex = 0,
+						.color     = ColorRgbs::cyan
+					}
+				}
+			);
+
+			CurrentScene::setParent(shield.getEntityId(), m_context.getEntityId());
+			m_shieldCreated = true;
+		}
+
+		if (Keyboard::isKeyPressed(KeyboardKey::keySpace)) {
+			if (!m_projectilePrefabId.has_value()) {
+				m_projectilePrefabId = CurrentScene::registerPrefab(
+					EntityConfig{
+						.appearanceConfig = AppearanceConfig{
+							.meshIndex     = 1,
+							.color         = ColorRgbs::magenta,
+							.materialIndex = 1
+						},
+						.behaviorFactory = BehaviorFactory::createFactoryFor<ProjectileBehavior>(3.0f)
+					}
+				);
+			}
+
+			CurrentScene::instantiatePrefab(
+				m_projectilePrefabId.value(),
+				TransformConfig{
+					.translation = transform.getTranslation(),
+					.rotation    = transform.getRotation(),
+					.scale       = Vector3{ .x = 0.5f, .y = 0.5f, .z = 1.0f }
 				}
 			);
 		}
@@ -135,6 +169,8 @@ int main() {
 				.resizable = true
 			},
 			.rendererConfig = RendererConfig{
+				// Materials only apply to direct draws
+				.renderingMode = RenderingMode::direct,
 				.meshes = std::vector<Mesh>{
 					{
 						.vertices = std::vector{
@@ -158,6 +194,14 @@ int main() {
 							Face{ .indices = { 0, 1, 2 } }
 						}
 					}
+				},
+				.materials = std::vector<MaterialConfig>{
+					{},
+					{
+						.blendMode               = BlendMode::additive,
+						.depthWrite              = false,
+						.specializationConstants = { 1 }
+					}
 				}
 			},
 			.sceneConfig = SceneConfig{
@@ -177,8 +221,8 @@ int main() {
 						.behaviorFactory = BehaviorFactory::createFactoryFor<PlayerBehavior>(10.0f, 270.0_deg)
 					}
 				},
-				.entityCreatedCallback   = [](EntityId) { updateTitle(); },
-				.entityDestroyedCallback = [](EntityId) { updateTitle(); }
+				.entityCreatedCallback   = [](std::span<const EntityId>) { updateTitle(); },
+				.entityDestroyedCallback = [](std::span<const EntityId>) { updateTitle(); }
 			},
 			.startScript = []() {
 				PerformanceCounters::setCountersUpdatedCallback(updateTitle);
@@ -203,6 +247,24 @@ int main() {
 						!Renderer::isUsingTripleBuffering()
 					);
 				}
+
+				if (Keyboard::isKeyPressed(KeyboardKey::keyF4) && Tracing::isEnabled()) {
+					Tracing::writeChromeTrace("Demo1Trace.json");
+				}
+
+				// Page allocations stay constant once projectiles are spawned and destroyed at a steady rate
+				if (Keyboard::isKeyPressed(KeyboardKey::keyF5)) {
+					auto& counters = PerformanceCounters::getBehaviorAllocationCounters();
+
+					Logger::info(
+						std::format(
+							"Behaviors created: {}, destroyed: {}, pool pages allocated: {}",
+							counters.pooledCreationCount,
+							counters.pooledDestructionCount,
+							counters.poolPageAllocationCount
+						)
+					);
+				}
 			}
 		}
 	);
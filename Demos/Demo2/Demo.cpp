@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <array>
+#include <format>
+#include <fstream>
+#include <string_view>
+#include <thread>
+
+#include <Miracle/Miracle.hpp>
+
+using namespace Miracle;
+
+// Measures direct mode frame times with single and multithreaded command recording
+class RecordingBenchmark {
+private:
+	struct Phase {
+		size_t entityCount = 0;
+		size_t recordingThreadCount = 1;
+	};
+
+	static constexpr size_t s_warmupFrameCount = 60;
+	static constexpr size_t s_measuredFrameCount = 300;
+
+	std::array<Phase, 4> m_phases;
+	size_t m_phaseIndex = 0;
+	size_t m_frameIndex = 0;
+	double m_measuredDuration = 0.0;
+	bool m_dumpLastFrame = false;
+
+public:
+	RecordingBenchmark() {
+		auto threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		m_phases = {
+			Phase{ .entityCount = 10000,  .recordingThreadCount = 1 },
+			Phase{ .entityCount = 10000,  .recordingThreadCount = threadCount },
+			Phase{ .entityCount = 100000, .recordingThreadCount = 1 },
+			Phase{ .entityCount = 100000, .recordingThreadCount = threadCount }
+		};
+	}
+
+	void start(bool dumpLastFrame) {
+		m_dumpLastFrame = dumpLastFrame;
+
+		beginPhase();
+	}
+
+	void update() {
+		m_frameIndex++;
+
+		if (m_frameIndex <= s_warmupFrameCount) return;
+
+		if (m_frameIndex == s_warmupFrameCount + 1) PerformanceCounters::resetFramePhaseTimings();
+
+		m_measuredDuration += DeltaTime::get();
+
+		if (m_frameIndex < s_warmupFrameCount + s_measuredFrameCount) return;
+
+		auto& phase = m_phases[m_phaseIndex];
+		auto averageFrameTime = m_measuredDuration / s_measuredFrameCount;
+
+		Logger::info(
+			std::format(
+				"Benchmark: {} entities, {} recording thread(s): {:.3f} ms per frame ({:.1f} FPS)",
+				phase.entityCount,
+				phase.recordingThreadCount,
+				averageFrameTime * 1000.0,
+				1.0 / averageFrameTime
+			)
+		);
+
+		Logger::info(
+			std::format(
+				"Benchmark: {} pipeline binds and {} buffer binds per frame",
+				PerformanceCounters::getPipelineBindCount(),
+				PerformanceCounters::getBufferBindCount()
+			)
+		);
+
+		logPhaseTimings("Recording", FramePhase::renderRecording);
+		logPhaseTimings("GPU render pass", FramePhase::gpuRenderPass);
+
+		m_phaseIndex++;
+
+		if (m_phaseIndex == m_phases.size()) {
+			if (m_dumpLastFrame) dumpLastFrame();
+
+			CurrentApp::close();
+			return;
+		}
+
+		beginPhase();
+	}
+
+private:
+	void beginPhase() {
+		auto& phase = m_phases[m_phaseIndex];
+
+		// The camera entity is not part of the benchmarked entities
+		while (CurrentScene::getEntityCount() - 1 < phase.entityCount) {
+			spawnEntity();
+		}
+
+		Renderer::setRecordingThreadCount(phase.recordingThreadCount);
+
+		m_frameIndex = 0;
+		m_measuredDuration = 0.0;
+	}
+
+	void logPhaseTimings(std::string_view phaseName, FramePhase phase) const {
+		auto timings = PerformanceCounters::getFramePhaseTimings(phase);
+
+		if (timings.sampleCount == 0) return;
+
+		Logger::info(
+			std::format(
+				"Benchmark: {}: min {:.3f} ms, avg {:.3f} ms, p99 {:.3f} ms",
+				phaseName,
+				timings.minimum.count() * 1000.0,
+				timings.average.count() * 1000.0,
+				timings.percentile99.count() * 1000.0
+			)
+		);
+	}
+
+	// Writes the last rendered frame as a binary PPM image, for comparing output between runs
+	void dumpLastFrame() const {
+		auto frame = Renderer::readLastFrame();
+
+		auto file = std::ofstream("Demo2LastFrame.ppm", std::ios::binary);
+
+		file << std::format("P6\n{} {}\n255\n", frame.width, frame.height);
+
+		for (size_t i = 0; i < frame.pixels.size(); i += 4) {
+			file.write(reinterpret_cast<const char*>(&frame.pixels[i]), 3);
+		}
+
+		Logger::info(std::format("Benchmark: last frame of {}x{} written to Demo2LastFrame.ppm", frame.width, frame.height));
+	}
+
+	void spawnEntity() {
+		auto& random = CurrentApp::getRandom();
+
+		CurrentScene::createEntity(
+			EntityConfig{
+				.transformConfig = TransformConfig{
+					.translation = Vector3{
+						.x = random.next(-4.0f, 4.0f),
+						.y = random.next(-3.0f, 3.0f),
+						.z = random.next(0.0f, 4.0f)
+					},
+					.scale = Vector3{ .x = 0.05f, .y = 0.05f, .z = 1.0f }
+				},
+				.appearanceConfig = AppearanceConfig{
+					.meshIndex = 0,
+					.color     = ColorRgb{
+						.redChannel   = random.next<float>(),
+						.greenChannel = random.next<float>(),
+						.blueChannel  = random.next<float>()
+					}
+				}
+			}
+		);
+	}
+};
+
+static RecordingBenchmark benchmark;
+
+int main(int argc, char** argv) {
+	// Headless runs need no display, so they can be used on machines without a GPU through a software Vulkan driver
+	bool headless = argc > 1 && std::string_view(argv[1]) == "--headless";
+
+	auto app = App(
+		"Demo 2",
+		AppConfig{
+			.windowConfig = WindowConfig{
+				.size = WindowSize{
+					.width  = 800,
+					.height = 600
+				},
+				.resizable = false,
+				.headless  = headless
+			},
+			.rendererConfig = RendererConfig{
+				.swapchainConfig = SwapchainConfig{
+					.useVsync = false
+				},
+				.renderingMode = RenderingMode::direct,
+				.meshes = std::vector<Mesh>{
+					{
+						.vertices = std::vector{
+							Vertex{ .position = Vector3{ .x = -0.5f, .y = -0.5f, .z = 0.0f } },
+							Vertex{ .position = Vector3{ .x =  0.5f, .y = -0.5f, .z = 0.0f } },
+							Vertex{ .position = Vector3{ .x =  0.5f, .y =  0.5f, .z = 0.0f } },
+							Vertex{ .position = Vector3{ .x = -0.5f, .y =  0.5f, .z = 0.0f } }
+						},
+						.faces = std::vector{
+							Face{ .indices = { 0, 1, 2 } },
+							Face{ .indices = { 0, 2, 3 } }
+						}
+					}
+				}
+			},
+			.sceneConfig = SceneConfig{
+				.entityConfigs = std::vector<EntityConfig>{
+					{
+						.transformConfig = TransformConfig{
+							.translation = Vector3{ 0.0f, 0.0f, -5.0f }
+						},
+						.cameraConfig = PerspectiveCameraConfig{}
+					}
+				}
+			},
+			.startScript = [=]() {
+				benchmark.start(headless);
+			},
+			.updateScript = []() {
+				if (Keyboard::isKeyPressed(KeyboardKey::keyEscape)) {
+					CurrentApp::close();
+				}
+
+				benchmark.update();
+			}
+		}
+	);
+
+	int exitCode = app.run();
+
+	return exitCode;
+}
@@ -0,0 +1,455 @@
+#include <chrono>
+#include <format>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <Miracle/Miracle.hpp>
+
+using namespace Miracle;
+
+struct Velocity {
+	Vector3 value = {};
+};
+
+class ProjectileBehavior : public BehaviorBase {
+private:
+	Vector3 m_velocity;
+
+public:
+	ProjectileBehavior(const EntityContext& context, const Vector3& velocity) :
+		BehaviorBase(context),
+		m_velocity(velocity)
+	{}
+
+	void act() override {
+		m_context.getTransform().translate(m_velocity, TransformSpace::scene);
+	}
+};
+
+template<typename Iteration>
+void measure(std::string_view name, size_t entityCount, size_t iterationCount, Iteration&& iteration) {
+	iteration();
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < iterationCount; i++) {
+		iteration();
+	}
+
+	auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+	auto entityIterationCount = static_cast<double>(entityCount * iterationCount);
+
+	Logger::info(
+		std::format(
+			"Benchmark: {}: {:.2f} ns per entity",
+			name,
+			duration.count() / entityIterationCount
+		)
+	);
+}
+
+// Compares the per-entity cost of iterating the scene through std::function with templated views
+class IterationBenchmark {
+private:
+	static constexpr size_t s_entityCount = 100000;
+	static constexpr size_t s_iterationCount = 100;
+
+	float m_checksum = 0.0f;
+
+public:
+	void run() {
+		spawnEntities();
+
+		// Every entity goes through a type-erased call, as scene iteration did before templated views
+		auto typeErasedForEach = std::function<void(const Transform&, const Appearance&)>(
+			[this](const Transform& transform, const Appearance& appearance) {
+				accumulate(transform, appearance);
+			}
+		);
+
+		measure(
+			"std::function per entity",
+			s_entityCount,
+			s_iterationCount,
+			[&]() {
+				CurrentScene::forEachEntity<Transform, Appearance>(
+					[&](const Transform& transform, const Appearance& appearance) {
+						typeErasedForEach(transform, appearance);
+					}
+				);
+			}
+		);
+
+		measure(
+			"Templated view",
+			s_entityCount,
+			s_iterationCount,
+			[&]() {
+				CurrentScene::forEachEntity<Transform, Appearance>(
+					[this](const Transform& transform, const Appearance& appearance) {
+						accumulate(transform, appearance);
+					}
+				);
+			}
+		);
+
+		Logger::info(std::format("Benchmark checksum: {}", m_checksum));
+	}
+
+private:
+	void spawnEntities() {
+		auto& random = CurrentApp::getRandom();
+
+		for (size_t i = 0; i < s_entityCount; i++) {
+			CurrentScene::createEntity(
+				EntityConfig{
+					.transformConfig = TransformConfig{
+						.translation = Vector3{
+							.x = random.next(-4.0f, 4.0f),
+							.y = random.next(-3.0f, 3.0f),
+							.z = random.next(0.0f, 4.0f)
+						}
+					},
+					.appearanceConfig = AppearanceConfig{
+						.meshIndex = 0,
+						.color     = ColorRgb{
+							.redChannel   = random.next<float>(),
+							.greenChannel = random.next<float>(),
+							.blueChannel  = random.next<float>()
+						}
+					}
+				}
+			);
+		}
+	}
+
+	void accumulate(const Transform& transform, const Appearance& appearance) {
+		m_checksum += transform.getTranslation().x * appearance.getColor().redChannel;
+	}
+};
+
+// Compares moving projectiles through virtual behaviors with moving them through a system
+class SystemBenchmark {
+private:
+	static constexpr size_t s_projectileCount = 100000;
+	static constexpr size_t s_iterationCount = 100;
+
+public:
+	void run() {
+		spawnProjectiles();
+
+		// Same inner loops as the scene update runs for behaviors and for systems respectively
+		measure(
+			"Behavior per projectile",
+			s_projectileCount,
+			s_iterationCount,
+			[]() {
+				CurrentScene::forEachEntity<BehaviorPointer>(
+					[](BehaviorPointer& behavior) {
+						behavior->act();
+					}
+				);
+			}
+		);
+
+		measure(
+			"System over projectiles",
+			s_projectileCount,
+			s_iterationCount,
+			[]() {
+				CurrentScene::forEachEntity<Transform, const Velocity>(
+					[](Transform& transform, const Velocity& velocity) {
+						transform.translate(velocity.value, TransformSpace::scene);
+					}
+				);
+			}
+		);
+	}
+
+private:
+	void spawnProjectiles() {
+		auto& random = CurrentApp::getRandom();
+
+		for (size_t i = 0; i < s_projectileCount; i++) {
+			auto velocity = Vector3{
+				.x = random.next(-0.01f, 0.01f),
+				.y = random.next(-0.01f, 0.01f),
+				.z = 0.0f
+			};
+
+			// Behavior driven projectile
+			CurrentScene::createEntity(
+				EntityConfig{
+					.behaviorFactory = BehaviorFactory::createFactoryFor<ProjectileBehavior>(velocity)
+				}
+			);
+
+			// System driven projectile
+			CurrentScene::createAndGetEntity(EntityConfig{})
+				.addComponent<Velocity>(velocity);
+		}
+	}
+};
+
+// Compares creating entities one at a time, from a prefab and as a batch from a prototype
+class SpawnBenchmark {
+private:
+	static constexpr size_t s_entityCount = 100000;
+
+public:
+	void run() {
+		auto prototype = EntityConfig{
+			.appearanceConfig = AppearanceConfig{
+				.meshIndex = 0
+			}
+		};
+
+		auto entities = std::vector<EntityId>();
+
+		measureSpawn(
+			"Entity per call",
+			[&]() {
+				for (size_t i = 0; i < s_entityCount; i++) {
+					entities.push_back(CurrentScene::createAndGetEntity(prototype).getEntityId());
+				}
+			}
+		);
+
+		CurrentScene::scheduleEntitiesDestruction(entities);
+
+		auto prefabId = CurrentScene::registerPrefab(prototype);
+
+		measureSpawn(
+			"Prefab instance per call",
+			[&]() {
+				entities.clear();
+
+				for (size_t i = 0; i < s_entityCount; i++) {
+					entities.push_back(CurrentScene::instantiatePrefab(prefabId).getEntityId());
+				}
+			}
+		);
+
+		CurrentScene::scheduleEntitiesDestruction(entities);
+
+		measureSpawn(
+			"Batch from prototype",
+			[&]() {
+				entities = CurrentScene::createEntities(prototype, s_entityCount);
+			}
+		);
+
+		CurrentScene::scheduleEntitiesDestruction(entities);
+	}
+
+private:
+	template<typename Spawn>
+	void measureSpawn(std::string_view name, Spawn&& spawn) {
+		auto startTime = std::chrono::steady_clock::now();
+
+		spawn();
+
+		auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+
+		Logger::info(
+			std::format(
+				"Benchmark: {}: {:.2f} ns per entity",
+				name,
+				duration.count() / static_cast<double>(s_entityCount)
+			)
+		);
+	}
+};
+
+// Compares the scalar math operators with the vectorized math kernels over the same transforms
+class MathBenchmark {
+private:
+	static constexpr size_t s_transformCount = 100000;
+	static constexpr size_t s_iterationCount = 100;
+
+	std::vector<Vector3> m_translations;
+	std::vector<Quaternion> m_rotations;
+	std::vector<Vector3> m_scales;
+	std::vector<Vector3> m_directions;
+	std::vector<Matrix4> m_transformations;
+	std::vector<Matrix4> m_projectedTransformations;
+	Matrix4 m_viewProjection = Matrix4s::identity;
+	float m_checksum = 0.0f;
+
+public:
+	void run() {
+		createInputs();
+
+		Logger::info(std::format("Benchmark: Math kernels use {}", MathKernels::getInstructionSet()));
+
+		measure(
+			"Scalar transformation composition",
+			s_transformCount,
+			s_iterationCount,
+			[this]() {
+				for (size_t i = 0; i < s_transformCount; i++) {
+					m_transformations[i] = Matrix4::createTransformation(m_translations[i], m_rotations[i], m_scales[i]);
+				}
+			}
+		);
+
+		measure(
+			"Kernel transformation composition",
+			s_transformCount,
+			s_iterationCount,
+			[this]() {
+				MathKernels::createTransformations(m_translations, m_rotations, m_scales, m_transformations);
+			}
+		);
+
+		measure(
+			"Scalar matrix multiplication",
+			s_transformCount,
+			s_iterationCount,
+			[this]() {
+				for (size_t i = 0; i < s_transformCount; i++) {
+					m_projectedTransformations[i] = m_transformations[i] * m_viewProjection;
+				}
+			}
+		);
+
+		measure(
+			"Kernel matrix multiplication",
+			s_transformCount,
+			s_iterationCount,
+			[this]() {
+				MathKernels::multiply(m_transformations, m_viewProjection, m_projectedTransformations);
+			}
+		);
+
+		auto rotatedDirections = std::vector<Vector3>(s_transformCount);
+
+		measure(
+			"Scalar quaternion rotation",
+			s_transformCount,
+			s_iterationCount,
+			[&]() {
+				for (size_t i = 0; i < s_transformCount; i++) {
+					rotatedDirections[i] = MathUtilities::rotateVector(m_directions[i], m_rotations[0]);
+				}
+			}
+		);
+
+		measure(
+			"Kernel quaternion rotation",
+			s_transformCount,
+			s_iterationCount,
+			[&]() {
+				MathKernels::rotateVectors(m_directions, m_rotations[0], rotatedDirections);
+			}
+		);
+
+		auto normalizedDirections = std::vector<Vector3>(s_transformCount);
+
+		measure(
+			"Scalar normalization",
+			s_transformCount,
+			s_iterationCount,
+			[&]() {
+				for (size_t i = 0; i < s_transformCount; i++) {
+					normalizedDirections[i] = m_directions[i].toNormalized();
+				}
+			}
+		);
+
+		measure(
+			"Kernel normalization",
+			s_transformCount,
+			s_iterationCount,
+			[&]() {
+				normalizedDirections = m_directions;
+				MathKernels::normalize(normalizedDirections);
+			}
+		);
+
+		for (size_t i = 0; i < s_transformCount; i++) {
+			m_checksum += m_projectedTransformations[i].m41 + rotatedDirections[i].x + normalizedDirections[i].y;
+		}
+
+		Logger::info(std::format("Benchmark checksum: {}", m_checksum));
+	}
+
+private:
+	void createInputs() {
+		auto& random = CurrentApp::getRandom();
+
+		for (size_t i = 0; i < s_transformCount; i++) {
+			m_translations.push_back(
+				Vector3{
+					.x = random.next(-4.0f, 4.0f),
+					.y = random.next(-3.0f, 3.0f),
+					.z = random.next(0.0f, 4.0f)
+				}
+			);
+
+			auto axis = Vector3{
+				.x = random.next(-1.0f, 1.0f),
+				.y = random.next(-1.0f, 1.0f),
+				.z = random.next(-1.0f, 1.0f)
+			};
+
+			m_rotations.push_back(
+				Quaternion::createRotation(axis.toNormalized(), Radians{ .value = random.next(-3.14f, 3.14f) })
+			);
+
+			m_scales.push_back(Vector3{ .x = 1.0f, .y = 1.0f, .z = 1.0f } * random.next(0.5f, 2.0f));
+			m_directions.push_back(axis);
+		}
+
+		m_transformations.resize(s_transformCount);
+		m_projectedTransformations.resize(s_transformCount);
+		m_viewProjection = Matrix4::createTranslation(Vector3{ .x = 0.0f, .y = 0.0f, .z = 2.0f })
+			* Matrix4::createPerspectiveProjection(16.0f / 9.0f, 1.0f, 0.1f, 100.0f);
+	}
+};
+
+int main() {
+	auto app = App(
+		"Demo 3",
+		AppConfig{
+			.windowConfig = WindowConfig{
+				.headless = true
+			},
+			.rendererConfig = RendererConfig{
+				.meshes = std::vector<Mesh>{
+					{
+						.vertices = std::vector{
+							Vertex{ .position = Vector3{ .x = -0.5f, .y = -0.5f, .z = 0.0f } },
+							Vertex{ .position = Vector3{ .x =  0.5f, .y = -0.5f, .z = 0.0f } },
+							Vertex{ .position = Vector3{ .x =  0.0f, .y =  0.5f, .z = 0.0f } }
+						},
+						.faces = std::vector{
+							Face{ .indices = { 0, 1, 2 } }
+						}
+					}
+				}
+			},
+			.startScript = []() {
+				auto iterationBenchmark = IterationBenchmark();
+				iterationBenchmark.run();
+
+				auto systemBenchmark = SystemBenchmark();
+				systemBenchmark.run();
+
+				auto spawnBenchmark = SpawnBenchmark();
+				spawnBenchmark.run();
+
+				auto mathBenchmark = MathBenchmark();
+				mathBenchmark.run();
+
+				CurrentApp::close();
+			}
+		}
+	);
+
+	int exitCode = app.run();
+
+	return exitCode;
+}
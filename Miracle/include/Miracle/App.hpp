@@ -39,6 +39,8 @@ namespace Miracle {
 		friend class Clipboard;
 		friend class DeltaTime;
 		friend class PerformanceCounters;
+		friend class Tracing;
+		friend class Jobs;
 
 	private:
 		static inline App* s_currentApp = nullptr;
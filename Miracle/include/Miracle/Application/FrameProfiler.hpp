@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include <Miracle/Common/Models/FramePhase.hpp>
+
+namespace Miracle::Application {
+	struct FramePhaseTimings {
+		std::chrono::duration<double> minimum = std::chrono::duration<double>(0.0);
+		std::chrono::duration<double> average = std::chrono::duration<double>(0.0);
+		std::chrono::duration<double> percentile99 = std::chrono::duration<double>(0.0);
+		size_t sampleCount = 0;
+	};
+
+	// Keeps the durations of each frame phase over the most recent frames
+	class FrameProfiler {
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct PhaseSamples {
+			std::vector<double> durations;
+			size_t nextSampleIndex = 0;
+			Clock::time_point beginTime = {};
+		};
+
+		static constexpr size_t s_phaseCount = static_cast<size_t>(FramePhase::gpuRenderPass) + 1;
+		static constexpr size_t s_sampleCapacity = 1000;
+
+		std::array<PhaseSamples, s_phaseCount> m_phaseSamplesList;
+
+	public:
+		FrameProfiler();
+
+		void beginPhase(FramePhase phase) {
+			m_phaseSamplesList[static_cast<size_t>(phase)].beginTime = Clock::now();
+		}
+
+		void endPhase(FramePhase phase) {
+			auto& phaseSamples = m_phaseSamplesList[static_cast<size_t>(phase)];
+
+			addSample(phaseSamples, std::chrono::duration<double>(Clock::now() - phaseSamples.beginTime).count());
+		}
+
+		void addPhaseDuration(FramePhase phase, std::chrono::duration<double> duration) {
+			addSample(m_phaseSamplesList[static_cast<size_t>(phase)], duration.count());
+		}
+
+		FramePhaseTimings getPhaseTimings(FramePhase phase) const;
+
+		void reset();
+
+	private:
+		static void addSample(PhaseSamples& phaseSamples, double duration);
+	};
+}
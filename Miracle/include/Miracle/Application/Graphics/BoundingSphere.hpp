@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Miracle/Common/Math/Vector3.hpp>
+#include <Miracle/Common/Math/Vector4.hpp>
+#include <Miracle/Common/Math/Matrix4.hpp>
+#include <Miracle/Common/Models/Vertex.hpp>
+
+namespace Miracle::Application {
+	struct BoundingSphere {
+		Vector3 center = {};
+		float radius = 0.0f;
+
+		// Centered on the bounding box of the vertices, which is tight enough for culling
+		static BoundingSphere createFromVertices(const std::vector<Vertex>& vertices) {
+			if (vertices.empty()) return BoundingSphere{};
+
+			auto min = vertices.front().position;
+			auto max = vertices.front().position;
+
+			for (auto& vertex : vertices) {
+				min.x = std::min(min.x, vertex.position.x);
+				min.y = std::min(min.y, vertex.position.y);
+				min.z = std::min(min.z, vertex.position.z);
+				max.x = std::max(max.x, vertex.position.x);
+				max.y = std::max(max.y, vertex.position.y);
+				max.z = std::max(max.z, vertex.position.z);
+			}
+
+			auto center = (min + max) / 2.0f;
+			float radius = 0.0f;
+
+			for (auto& vertex : vertices) {
+				radius = std::max(radius, center.distanceTo(vertex.position));
+			}
+
+			return BoundingSphere{
+				.center = center,
+				.radius = radius
+			};
+		}
+
+		// The radius is scaled by the largest axis scale, so the sphere stays conservative under non-uniform scaling
+		BoundingSphere toTransformed(const Matrix4& transformation) const {
+			auto& m = transformation;
+
+			float maxScaleSquared = std::max({
+				m.m11 * m.m11 + m.m12 * m.m12 + m.m13 * m.m13,
+				m.m21 * m.m21 + m.m22 * m.m22 + m.m23 * m.m23,
+				m.m31 * m.m31 + m.m32 * m.m32 + m.m33 * m.m33
+			});
+
+			auto transformedCenter = Vector4::createFromVector3(center, 1.0f) * transformation;
+
+			return BoundingSphere{
+				.center = Vector3{
+					.x = transformedCenter.x,
+					.y = transformedCenter.y,
+					.z = transformedCenter.z
+				},
+				.radius = radius * std::sqrt(maxScaleSquared)
+			};
+		}
+	};
+}
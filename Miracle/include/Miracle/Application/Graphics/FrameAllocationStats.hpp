@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Miracle::Application {
+	struct FrameAllocationStats {
+		size_t lastFrameBytesUsed = 0;
+		size_t peakFrameBytesUsed = 0;
+		size_t bytesReserved = 0;
+	};
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Miracle::Application {
+	// Pixels are stored row by row without padding, as 8-bit sRGB red, green, blue and alpha channels
+	struct FrameImage {
+		unsigned int width = 0;
+		unsigned int height = 0;
+		std::vector<std::byte> pixels = {};
+	};
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include <Miracle/Common/Math/Matrix4.hpp>
+#include <Miracle/Common/Math/Vector4.hpp>
+#include "BoundingSphere.hpp"
+
+namespace Miracle::Application {
+	struct Frustum {
+		// Normalized planes facing inwards, with the plane distance stored in w
+		std::array<Vector4, 6> planes = {};
+
+		static Frustum createFromViewProjection(const Matrix4& viewProjection) {
+			auto& m = viewProjection;
+
+			// Points are row vectors, so each clip space coordinate is a column of the matrix
+			auto frustum = Frustum{
+				.planes = {
+					Vector4{ m.m14 + m.m11, m.m24 + m.m21, m.m34 + m.m31, m.m44 + m.m41 },
+					Vector4{ m.m14 - m.m11, m.m24 - m.m21, m.m34 - m.m31, m.m44 - m.m41 },
+					Vector4{ m.m14 + m.m12, m.m24 + m.m22, m.m34 + m.m32, m.m44 + m.m42 },
+					Vector4{ m.m14 - m.m12, m.m24 - m.m22, m.m34 - m.m32, m.m44 - m.m42 },
+					Vector4{ m.m13, m.m23, m.m33, m.m43 },
+					Vector4{ m.m14 - m.m13, m.m24 - m.m23, m.m34 - m.m33, m.m44 - m.m43 }
+				}
+			};
+
+			for (auto& plane : frustum.planes) {
+				float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+				if (length != 0.0f) {
+					plane /= length;
+				}
+			}
+
+			return frustum;
+		}
+
+		bool intersects(const BoundingSphere& sphere) const {
+			for (auto& plane : planes) {
+				float distance = plane.x * sphere.center.x
+					+ plane.y * sphere.center.y
+					+ plane.z * sphere.center.z
+					+ plane.w;
+
+				if (distance < -sphere.radius) return false;
+			}
+
+			return true;
+		}
+	};
+}
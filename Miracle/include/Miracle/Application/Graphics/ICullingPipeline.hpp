@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include <Miracle/Common/MiracleError.hpp>
+#include <Miracle/Common/Math/ColorRgb.hpp>
+#include <Miracle/Common/Math/Matrix4.hpp>
+#include "Frustum.hpp"
+#include "MeshRange.hpp"
+
+namespace Miracle::Application {
+	// Matches the instance layout read by the culling compute shader
+	struct CullingInstanceData {
+		Matrix4 transform = {};
+		ColorRgb color = {};
+		uint32_t drawIndex = 0;
+	};
+
+	struct CullingDraw {
+		MeshRange meshRange = {};
+		uint32_t firstInstance = 0;
+	};
+
+	class ICullingPipeline {
+	public:
+		virtual ~ICullingPipeline() = default;
+
+		// Graphics command, must be recorded outside of a render pass
+		virtual void cull(
+			const Frustum& frustum,
+			std::span<const CullingDraw> draws,
+			std::span<const CullingInstanceData> instances
+		) = 0;
+
+		// Graphics command
+		virtual void bindCulledInstances() = 0;
+
+		// Graphics command
+		virtual void drawCulled(uint32_t drawIndex) = 0;
+	};
+
+	struct CullingPipelineInitProps {
+		std::filesystem::path computeShaderPath = {};
+	};
+
+	namespace CullingPipelineErrors {
+		class CreationError : public CullingPipelineError {
+		public:
+			CreationError() : CullingPipelineError(
+				CullingPipelineError::ErrorValue::creationError,
+				"Failed to create culling pipeline"
+			) {}
+		};
+	}
+}
@@ -12,8 +12,10 @@
 #include "IGraphicsContext.hpp"
 #include "ISwapchain.hpp"
 #include "IGraphicsPipeline.hpp"
+#include "ICullingPipeline.hpp"
 #include "IVertexBuffer.hpp"
 #include "IIndexBuffer.hpp"
+#include "IInstanceBuffer.hpp"
 
 namespace Miracle::Application {
 	class IGraphicsApi {
@@ -22,6 +24,7 @@ namespace Miracle::Application {
 
 		virtual std::unique_ptr<IGraphicsContext> createGraphicsContext(
 			const std::string_view& appName,
+			IFileAccess& fileAccess,
 			IContextTarget& target
 		) const = 0;
 
@@ -33,17 +36,28 @@ namespace Miracle::Application {
 		virtual std::unique_ptr<IGraphicsPipeline> createGraphicsPipeline(
 			IFileAccess& fileAccess,
 			IGraphicsContext& context,
-			ISwapchain& swapchain
+			ISwapchain& swapchain,
+			const GraphicsPipelineInitProps& initProps
+		) const = 0;
+
+		virtual std::unique_ptr<ICullingPipeline> createCullingPipeline(
+			IFileAccess& fileAccess,
+			IGraphicsContext& context,
+			const CullingPipelineInitProps& initProps
 		) const = 0;
 
 		virtual std::unique_ptr<IVertexBuffer> createVertexBuffer(
 			IGraphicsContext& context,
-			const std::vector<Vertex>& vertices
+			uint32_t vertexCapacity
 		) const = 0;
 
 		virtual std::unique_ptr<IIndexBuffer> createIndexBuffer(
 			IGraphicsContext& context,
-			const std::vector<Face>& faces
+			uint32_t faceCapacity
+		) const = 0;
+
+		virtual std::unique_ptr<IInstanceBuffer> createInstanceBuffer(
+			IGraphicsContext& context
 		) const = 0;
 	};
 }
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <functional>
+#include <chrono>
+#include <optional>
+#include <cstddef>
 #include <cstdint>
 
 #include <Miracle/Common/MiracleError.hpp>
 #include "IContextTarget.hpp"
+#include "FrameAllocationStats.hpp"
 
 namespace Miracle::Application {
 	class IGraphicsContext {
@@ -31,19 +35,56 @@ namespace Miracle::Application {
 		virtual void draw(uint32_t vertexCount) = 0;
 
 		// Graphics command
-		virtual void drawIndexed(uint32_t indexCount) = 0;
+		virtual void drawIndexed(
+			uint32_t indexCount,
+			uint32_t firstIndex,
+			int32_t vertexOffset
+		) = 0;
+
+		// Graphics command
+		virtual void drawIndexedInstanced(
+			uint32_t indexCount,
+			uint32_t instanceCount,
+			uint32_t firstIndex,
+			int32_t vertexOffset,
+			uint32_t firstInstance
+		) = 0;
 
 		virtual IContextTarget& getTarget() = 0;
 
+		virtual size_t getFramesInFlight() const = 0;
+
 		virtual void recordGraphicsCommands(const std::function<void()>& recording) = 0;
 
 		virtual void recordTransferCommands(const std::function<void()>& recording) = 0;
 
+		virtual void reserveSecondaryGraphicsRecorders(size_t recorderCount) = 0;
+
+		// May be called from several threads at once, as long as each uses its own recorder
+		virtual void recordSecondaryGraphicsCommands(
+			size_t recorderIndex,
+			const std::function<void()>& recording
+		) = 0;
+
+		// Graphics command
+		virtual void executeSecondaryGraphicsCommands(size_t recorderCount) = 0;
+
 		virtual void submitGraphicsRecording() = 0;
 
 		virtual void submitTransferRecording() = 0;
 
 		virtual void waitForDeviceIdle() = 0;
+
+		// Graphics command
+		virtual void beginGpuTiming() = 0;
+
+		// Graphics command
+		virtual void endGpuTiming() = 0;
+
+		// GPU time between the timing commands of the frame read back when the latest recording began, if any
+		virtual std::optional<std::chrono::duration<double>> getLastGpuTimingDuration() const = 0;
+
+		virtual FrameAllocationStats getFrameAllocationStats() const = 0;
 	};
 
 	namespace GraphicsContextErrors {
@@ -86,5 +127,21 @@ namespace Miracle::Application {
 				"No Graphics card supported"
 			) {}
 		};
+
+		class FrameAllocationError : public GraphicsContextError {
+		public:
+			FrameAllocationError() : GraphicsContextError(
+				GraphicsContextError::ErrorValue::frameAllocationError,
+				"Failed to allocate per-frame graphics memory"
+			) {}
+		};
+
+		class UploadError : public GraphicsContextError {
+		public:
+			UploadError() : GraphicsContextError(
+				GraphicsContextError::ErrorValue::uploadError,
+				"Failed to upload data to graphics memory"
+			) {}
+		};
 	}
 }
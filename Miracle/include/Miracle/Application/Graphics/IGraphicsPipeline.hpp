@@ -1,6 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
 #include <Miracle/Common/MiracleError.hpp>
+#include <Miracle/Common/Models/CullMode.hpp>
+#include <Miracle/Common/Models/BlendMode.hpp>
 #include "PushConstants.hpp"
 
 namespace Miracle::Application {
@@ -15,6 +21,29 @@ namespace Miracle::Application {
 		virtual void pushConstants(const PushConstants& constants) = 0;
 	};
 
+	enum class GraphicsPipelineDepthMode {
+		// Tests and writes depth
+		readWrite,
+		// Only writes depth, without a fragment shader or color output
+		prePass,
+		// Tests against depth written by a pre-pass, without writing it
+		readOnly,
+		disabled
+	};
+
+	struct GraphicsPipelineInitProps {
+		std::filesystem::path vertexShaderPath = {};
+		std::filesystem::path fragmentShaderPath = {};
+		bool useInstanceData = false;
+		GraphicsPipelineDepthMode depthMode = GraphicsPipelineDepthMode::readWrite;
+		CullMode cullMode = CullMode::none;
+		BlendMode blendMode = BlendMode::opaque;
+		// Values of the specialization constants of both shader stages, by constant ID
+		std::vector<uint32_t> specializationConstants = {};
+
+		bool operator==(const GraphicsPipelineInitProps&) const = default;
+	};
+
 	namespace GraphicsPipelineErrors {
 		class CreationError : public GraphicsPipelineError {
 		public:
@@ -1,15 +1,19 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #include <Miracle/Common/MiracleError.hpp>
+#include <Miracle/Common/Models/Face.hpp>
 
 namespace Miracle::Application {
 	class IIndexBuffer {
 	public:
 		virtual ~IIndexBuffer() = default;
 
-		virtual uint32_t getIndexCount() const = 0;
+		virtual uint32_t getFaceCapacity() const = 0;
+
+		virtual void write(uint32_t firstFace, std::span<const Face> faces) = 0;
 
 		// Graphics command
 		virtual void bind() = 0;
@@ -20,7 +24,7 @@ namespace Miracle::Application {
 		public:
 			NoIndicesProvidedError() : IndexBufferError(
 				IndexBufferError::ErrorValue::noIndicesProvidedError,
-				"No indices were provided for index buffer creation"
+				"No face capacity was provided for index buffer creation"
 			) {}
 		};
 
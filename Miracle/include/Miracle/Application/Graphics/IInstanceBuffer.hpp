@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "InstanceData.hpp"
+
+namespace Miracle::Application {
+	class IInstanceBuffer {
+	public:
+		virtual ~IInstanceBuffer() = default;
+
+		virtual uint32_t getInstanceCapacity() const = 0;
+
+		// Must be called every frame while recording graphics commands, before any instances are written
+		virtual void reserve(uint32_t instanceCount) = 0;
+
+		virtual void write(uint32_t firstInstance, std::span<const InstanceData> instances) = 0;
+
+		// Graphics command
+		virtual void bind() = 0;
+	};
+}
@@ -2,6 +2,7 @@
 
 #include <Miracle/Common/MiracleError.hpp>
 #include <Miracle/Common/Math/ColorRgb.hpp>
+#include "FrameImage.hpp"
 
 namespace Miracle::Application {
 	struct SwapchainImageSize {
@@ -16,7 +17,7 @@ namespace Miracle::Application {
 		virtual SwapchainImageSize getImageSize() const = 0;
 
 		// Graphics command
-		virtual void beginRenderPass(ColorRgb clearColor) = 0;
+		virtual void beginRenderPass(ColorRgb clearColor, bool useSecondaryCommands) = 0;
 
 		// Graphics command
 		virtual void endRenderPass() = 0;
@@ -25,6 +26,9 @@ namespace Miracle::Application {
 
 		virtual void recreate() = 0;
 
+		// Waits for the device to finish, then reads back the most recently swapped image
+		virtual FrameImage readLastImage() = 0;
+
 		virtual bool isUsingVsync() const = 0;
 
 		virtual void setVsync(bool useVsync) = 0;
@@ -47,5 +51,13 @@ namespace Miracle::Application {
 				"Failed to create swapchain"
 			) {}
 		};
+
+		class ReadbackError : public SwapchainError {
+		public:
+			ReadbackError() : SwapchainError(
+				SwapchainError::ErrorValue::readbackError,
+				"Failed to read back swapchain image"
+			) {}
+		};
 	}
 }
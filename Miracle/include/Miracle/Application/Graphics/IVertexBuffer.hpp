@@ -1,15 +1,19 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #include <Miracle/Common/MiracleError.hpp>
+#include <Miracle/Common/Models/Vertex.hpp>
 
 namespace Miracle::Application {
 	class IVertexBuffer {
 	public:
 		virtual ~IVertexBuffer() = default;
 
-		virtual uint32_t getVertexCount() const = 0;
+		virtual uint32_t getVertexCapacity() const = 0;
+
+		virtual void write(uint32_t firstVertex, std::span<const Vertex> vertices) = 0;
 
 		// Graphics command
 		virtual void bind() = 0;
@@ -20,7 +24,7 @@ namespace Miracle::Application {
 		public:
 			NoVerticesProvidedError() : VertexBufferError(
 				VertexBufferError::ErrorValue::noVerticesProvidedError,
-				"No vertices were provided for vertex buffer creation"
+				"No vertex capacity was provided for vertex buffer creation"
 			) {}
 		};
 
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <Miracle/Common/Math/Matrix4.hpp>
+#include <Miracle/Common/Math/ColorRgb.hpp>
+
+namespace Miracle::Application {
+	struct InstanceData {
+		Matrix4 transform = Matrix4s::identity;
+		ColorRgb color = {};
+	};
+}
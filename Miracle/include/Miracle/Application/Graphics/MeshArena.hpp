@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Miracle/Common/MiracleError.hpp>
+#include <Miracle/Common/Models/Mesh.hpp>
+#include <Miracle/Application/ILogger.hpp>
+#include "IGraphicsApi.hpp"
+#include "IGraphicsContext.hpp"
+#include "IVertexBuffer.hpp"
+#include "IIndexBuffer.hpp"
+#include "MeshRange.hpp"
+#include "RangeAllocator.hpp"
+
+namespace Miracle::Application {
+	class MeshArena {
+	private:
+		struct Page {
+			std::unique_ptr<IVertexBuffer> vertexBuffer;
+			std::unique_ptr<IIndexBuffer> indexBuffer;
+			RangeAllocator vertexAllocator;
+			RangeAllocator faceAllocator;
+		};
+
+		struct Allocation {
+			size_t pageIndex = 0;
+			uint32_t firstVertex = 0;
+			uint32_t vertexCount = 0;
+			uint32_t firstFace = 0;
+			uint32_t faceCount = 0;
+		};
+
+		struct Slot {
+			bool loaded = false;
+			Allocation allocation = {};
+			MeshRange range = {};
+		};
+
+		struct PendingRelease {
+			Allocation allocation = {};
+			uint64_t frameNumber = 0;
+		};
+
+		static constexpr uint32_t s_pageVertexCapacity = 256 * 1024;
+		static constexpr uint32_t s_pageFaceCapacity = 256 * 1024;
+
+		ILogger& m_logger;
+		IGraphicsApi& m_api;
+		IGraphicsContext& m_context;
+
+		std::vector<Page> m_pages;
+		std::vector<Slot> m_slots;
+		std::vector<size_t> m_freeSlotIndices;
+		std::vector<PendingRelease> m_pendingReleases;
+		uint64_t m_frameNumber = 0;
+
+	public:
+		MeshArena(
+			ILogger& logger,
+			IGraphicsApi& api,
+			IGraphicsContext& context,
+			const std::vector<Mesh>& meshes
+		);
+
+		size_t getMeshCount() const { return m_slots.size(); }
+
+		bool isMeshLoaded(size_t meshIndex) const {
+			return meshIndex < m_slots.size() && m_slots[meshIndex].loaded;
+		}
+
+		const MeshRange& getMeshRange(size_t meshIndex) const { return m_slots[meshIndex].range; }
+
+		size_t getMeshResidentBytes(size_t meshIndex) const;
+
+		size_t getResidentBytes() const;
+
+		size_t addMesh(const Mesh& mesh);
+
+		void replaceMesh(size_t meshIndex, const Mesh& mesh);
+
+		void removeMesh(size_t meshIndex);
+
+		// Releases the memory of removed meshes no longer referenced by any frame in flight
+		void beginFrame();
+
+		// Graphics command
+		void bindPage(size_t pageIndex);
+
+	private:
+		Allocation allocate(const Mesh& mesh, uint32_t minVertexCapacity, uint32_t minFaceCapacity);
+
+		void upload(const Allocation& allocation, const Mesh& mesh);
+
+		void release(const Allocation& allocation);
+
+		MeshRange createMeshRange(const Allocation& allocation, const Mesh& mesh) const;
+
+		void validateMesh(const Mesh& mesh) const;
+
+		void validateMeshLoaded(size_t meshIndex) const;
+	};
+
+	namespace MeshArenaErrors {
+		class EmptyMeshError : public MeshArenaError {
+		public:
+			EmptyMeshError() : MeshArenaError(
+				MeshArenaError::ErrorValue::emptyMeshError,
+				"Mesh has no vertices or faces"
+			) {}
+		};
+
+		class MeshNotLoadedError : public MeshArenaError {
+		public:
+			MeshNotLoadedError() : MeshArenaError(
+				MeshArenaError::ErrorValue::meshNotLoadedError,
+				"No mesh is loaded at the given mesh index"
+			) {}
+		};
+	}
+}
@@ -1,13 +0,0 @@
-#pragma once
-
-#include <memory>
-
-#include "IVertexBuffer.hpp"
-#include "IIndexBuffer.hpp"
-
-namespace Miracle::Application {
-	struct MeshBuffers {
-		std::unique_ptr<IVertexBuffer> vertexBuffer;
-		std::unique_ptr<IIndexBuffer> indexBuffer;
-	};
-}
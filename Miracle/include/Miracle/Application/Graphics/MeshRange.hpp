@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BoundingSphere.hpp"
+
+namespace Miracle::Application {
+	struct MeshRange {
+		size_t pageIndex = 0;
+		uint32_t firstIndex = 0;
+		uint32_t indexCount = 0;
+		int32_t vertexOffset = 0;
+		BoundingSphere bounds = {};
+	};
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <Miracle/Application/ILogger.hpp>
+#include <Miracle/Application/IFileAccess.hpp>
+#include <Miracle/Application/JobSystem.hpp>
+#include "IGraphicsApi.hpp"
+#include "IGraphicsContext.hpp"
+#include "ISwapchain.hpp"
+#include "IGraphicsPipeline.hpp"
+
+namespace Miracle::Application {
+	// Creates each distinct pipeline state once, identified by its hash, and on worker threads where possible
+	class PipelineLibrary {
+	private:
+		enum class PipelineState : uint8_t {
+			pending,
+			ready,
+			failed
+		};
+
+		struct Entry {
+			GraphicsPipelineInitProps initProps = {};
+			std::unique_ptr<IGraphicsPipeline> pipeline = nullptr;
+			std::exception_ptr exception = nullptr;
+			std::atomic<PipelineState> state = PipelineState::pending;
+		};
+
+		ILogger& m_logger;
+		IFileAccess& m_fileAccess;
+		IGraphicsApi& m_api;
+		IGraphicsContext& m_context;
+		ISwapchain& m_swapchain;
+		JobSystem& m_jobSystem;
+
+		// Entries are kept behind pointers, as creation jobs write to them while more are added
+		std::vector<std::unique_ptr<Entry>> m_entries;
+		std::unordered_multimap<size_t, size_t> m_entryIndicesByHash;
+		JobCounter m_creationCounter;
+
+	public:
+		PipelineLibrary(
+			ILogger& logger,
+			IFileAccess& fileAccess,
+			IGraphicsApi& api,
+			IGraphicsContext& context,
+			ISwapchain& swapchain,
+			JobSystem& jobSystem
+		);
+
+		~PipelineLibrary();
+
+		size_t getPipelineCount() const { return m_entries.size(); }
+
+		// Returns the index of the pipeline with the given state, scheduling its creation if it does not exist yet
+		size_t request(const GraphicsPipelineInitProps& initProps);
+
+		// Like request, but the pipeline is created on the calling thread and can be used right away.
+		// Rethrows the error if its creation failed
+		size_t require(const GraphicsPipelineInitProps& initProps);
+
+		// Returns nullptr while the pipeline is being created, or if its creation failed
+		IGraphicsPipeline* getPipeline(size_t pipelineIndex) const;
+
+	private:
+		size_t findOrAddEntry(const GraphicsPipelineInitProps& initProps, bool& isAdded);
+
+		void createPipeline(Entry& entry, size_t pipelineIndex);
+
+		static size_t createHash(const GraphicsPipelineInitProps& initProps);
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Miracle::Application {
+	class RangeAllocator {
+	private:
+		struct FreeRange {
+			uint32_t offset = 0;
+			uint32_t size = 0;
+		};
+
+		uint32_t m_capacity;
+		std::vector<FreeRange> m_freeRanges;
+
+	public:
+		RangeAllocator(uint32_t capacity);
+
+		uint32_t getCapacity() const { return m_capacity; }
+
+		std::optional<uint32_t> allocate(uint32_t size);
+
+		void free(uint32_t offset, uint32_t size);
+	};
+}
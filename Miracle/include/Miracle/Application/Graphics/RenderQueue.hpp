@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Miracle::Application {
+	struct RenderQueueEntry {
+		uint64_t sortKey = 0;
+		uint32_t drawIndex = 0;
+	};
+
+	// Orders the opaque draws of a frame by pipeline, then mesh, then front to back, so state is bound once per run of draws.
+	// Blended draws come after them, back to front
+	class RenderQueue {
+	private:
+		static constexpr uint32_t s_blendedBitCount = 1;
+		static constexpr uint32_t s_pipelineBitCount = 10;
+		static constexpr uint32_t s_pageBitCount = 8;
+		static constexpr uint32_t s_meshBitCount = 13;
+		static constexpr uint32_t s_depthBitCount = 32;
+
+		static constexpr uint32_t s_radixBitCount = 8;
+		static constexpr uint32_t s_radixCount = 1 << s_radixBitCount;
+		static constexpr uint32_t s_passCount = 64 / s_radixBitCount;
+
+		std::vector<RenderQueueEntry> m_entries;
+		std::vector<RenderQueueEntry> m_sortBuffer;
+		std::vector<uint32_t> m_radixCounts;
+
+	public:
+		RenderQueue();
+
+		static constexpr size_t getMaxPipelineCount() { return size_t(1) << s_pipelineBitCount; }
+
+		// Indices beyond their field width wrap, which only makes the order less grouped
+		static uint64_t createOpaqueSortKey(size_t pipelineIndex, size_t pageIndex, size_t meshIndex, float depth);
+
+		static uint64_t createBlendedSortKey(size_t pipelineIndex, size_t pageIndex, size_t meshIndex, float depth);
+
+		size_t getSize() const { return m_entries.size(); }
+
+		bool isEmpty() const { return m_entries.empty(); }
+
+		std::span<const RenderQueueEntry> getEntries() const { return m_entries; }
+
+		void clear() { m_entries.clear(); }
+
+		void push(uint64_t sortKey, uint32_t drawIndex) {
+			m_entries.push_back(
+				RenderQueueEntry{
+					.sortKey   = sortKey,
+					.drawIndex = drawIndex
+				}
+			);
+		}
+
+		// Stable, so draws with equal keys keep the order they were pushed in
+		void sort();
+
+	private:
+		static uint64_t createStateBits(size_t pipelineIndex, size_t pageIndex, size_t meshIndex);
+
+		static uint32_t createDepthBits(float depth);
+	};
+}
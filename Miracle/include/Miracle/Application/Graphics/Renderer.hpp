@@ -1,36 +1,113 @@
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 #include <Miracle/Common/Math/ColorRgb.hpp>
 #include <Miracle/Common/Models/Mesh.hpp>
+#include <Miracle/Common/Models/MaterialConfig.hpp>
+#include <Miracle/Common/Models/RenderingMode.hpp>
 #include <Miracle/Application/Models/Scene.hpp>
 #include <Miracle/Application/ILogger.hpp>
 #include <Miracle/Application/IFileAccess.hpp>
+#include <Miracle/Application/JobSystem.hpp>
+#include <Miracle/Application/FrameProfiler.hpp>
 #include "IGraphicsApi.hpp"
 #include "IGraphicsContext.hpp"
 #include "ISwapchain.hpp"
 #include "IGraphicsPipeline.hpp"
-#include "MeshBuffers.hpp"
+#include "ICullingPipeline.hpp"
+#include "IInstanceBuffer.hpp"
+#include "InstanceData.hpp"
+#include "Frustum.hpp"
+#include "MeshArena.hpp"
+#include "PipelineLibrary.hpp"
+#include "RenderQueue.hpp"
 #include "PushConstants.hpp"
 
 namespace Miracle::Application {
 	struct RendererInitProps{
 		SwapchainInitProps swapchainInitProps = {};
+		RenderingMode renderingMode = RenderingMode::direct;
+		size_t recordingThreadCount = 1;
+		bool useDepthPrePass = false;
 		const std::vector<Mesh>& meshes = {};
+		const std::vector<MaterialConfig>& materials = {};
 	};
 
 	class Renderer {
 	private:
+		struct Material {
+			MaterialConfig config = {};
+			// Pipelines are requested the first time the material is drawn with them
+			std::optional<size_t> pipelineIndex = std::nullopt;
+			std::optional<size_t> depthPrePassPipelineIndex = std::nullopt;
+			std::optional<size_t> depthReadOnlyPipelineIndex = std::nullopt;
+		};
+
+		// Pipelines a material draws with in the current frame, falling back to the default ones while its own are pending or failed
+		struct MaterialDrawState {
+			bool isResolved = false;
+			bool isBlended = false;
+			size_t pipelineIndex = 0;
+			IGraphicsPipeline* pipeline = nullptr;
+			IGraphicsPipeline* depthPrePassPipeline = nullptr;
+		};
+
+		struct DirectDraw {
+			PushConstants pushConstants = {};
+			size_t meshIndex = 0;
+			IGraphicsPipeline* pipeline = nullptr;
+			// Draws without one are left out of the depth pre-pass
+			IGraphicsPipeline* depthPrePassPipeline = nullptr;
+		};
+
+		// State bound in the command buffer being recorded, which starts out with nothing bound
+		struct BindState {
+			const IGraphicsPipeline* pipeline = nullptr;
+			size_t pageIndex = std::numeric_limits<size_t>::max();
+			size_t pipelineBindCount = 0;
+			size_t bufferBindCount = 0;
+		};
+
 		ILogger& m_logger;
 		IFileAccess& m_fileAccess;
 		IGraphicsApi& m_api;
 		IGraphicsContext& m_context;
+		FrameProfiler& m_frameProfiler;
+		JobSystem& m_jobSystem;
 
 		std::unique_ptr<ISwapchain> m_swapchain;
-		std::unique_ptr<IGraphicsPipeline> m_pipeline;
-		std::vector<MeshBuffers> m_meshBuffersList;
+		PipelineLibrary m_pipelineLibrary;
+		size_t m_defaultPipelineIndex;
+		std::unique_ptr<IGraphicsPipeline> m_instancedPipeline;
+		std::unique_ptr<ICullingPipeline> m_cullingPipeline;
+		std::unique_ptr<IInstanceBuffer> m_instanceBuffer;
+		MeshArena m_meshArena;
+		std::vector<std::vector<InstanceData>> m_meshInstancesList;
+		std::vector<Material> m_materials;
+		std::vector<MaterialDrawState> m_materialDrawStates;
+
+		std::vector<DirectDraw> m_directDraws;
+		RenderQueue m_renderQueue;
+		std::vector<BindState> m_recorderBindStates;
+		std::vector<Matrix4> m_directDrawTransforms;
+		std::vector<size_t> m_directDrawMaterialIndices;
+		std::vector<CullingInstanceData> m_cullingInstances;
+		std::vector<CullingDraw> m_cullingDraws;
+		std::vector<uint32_t> m_meshInstanceCounts;
+
+		size_t m_drawnEntityCount = 0;
+		size_t m_culledEntityCount = 0;
+		size_t m_pipelineBindCount = 0;
+		size_t m_bufferBindCount = 0;
+
+		RenderingMode m_renderingMode;
+		size_t m_recordingThreadCount = 1;
+		bool m_useDepthPrePass;
 
 	public:
 		Renderer(
@@ -38,6 +115,8 @@ namespace Miracle::Application {
 			IFileAccess& fileAccess,
 			IGraphicsApi& api,
 			IGraphicsContext& context,
+			FrameProfiler& frameProfiler,
+			JobSystem& jobSystem,
 			const RendererInitProps& initProps
 		);
 
@@ -66,9 +145,95 @@ namespace Miracle::Application {
 			m_swapchain->recreate();
 		}
 
+		RenderingMode getRenderingMode() const { return m_renderingMode; }
+
+		void setRenderingMode(RenderingMode renderingMode) { m_renderingMode = renderingMode; }
+
+		size_t getRecordingThreadCount() const { return m_recordingThreadCount; }
+
+		// Direct draws are split over this many secondary command buffers, recorded in parallel on the job system
+		void setRecordingThreadCount(size_t recordingThreadCount);
+
+		bool isUsingDepthPrePass() const { return m_useDepthPrePass; }
+
+		// Only applies to direct draws
+		void setDepthPrePass(bool useDepthPrePass) { m_useDepthPrePass = useDepthPrePass; }
+
+		size_t getDrawnEntityCount() const { return m_drawnEntityCount; }
+
+		size_t getCulledEntityCount() const { return m_culledEntityCount; }
+
+		size_t getPipelineBindCount() const { return m_pipelineBindCount; }
+
+		size_t getBufferBindCount() const { return m_bufferBindCount; }
+
+		FrameImage readLastFrame() { return m_swapchain->readLastImage(); }
+
+		FrameAllocationStats getFrameAllocationStats() const { return m_context.getFrameAllocationStats(); }
+
+		size_t addMesh(const Mesh& mesh) { return m_meshArena.addMesh(mesh); }
+
+		void replaceMesh(size_t meshIndex, const Mesh& mesh) { m_meshArena.replaceMesh(meshIndex, mesh); }
+
+		void removeMesh(size_t meshIndex) { m_meshArena.removeMesh(meshIndex); }
+
+		bool isMeshLoaded(size_t meshIndex) const { return m_meshArena.isMeshLoaded(meshIndex); }
+
+		size_t getMaterialCount() const { return m_materials.size(); }
+
+		// The material's pipelines are created in the background once it is first drawn
+		size_t addMaterial(const MaterialConfig& materialConfig);
+
+		// Distinct pipeline states requested by materials so far
+		size_t getGraphicsPipelineCount() const { return m_pipelineLibrary.getPipelineCount(); }
+
+		size_t getMeshResidentBytes(size_t meshIndex) const { return m_meshArena.getMeshResidentBytes(meshIndex); }
+
+		size_t getResidentMeshBytes() const { return m_meshArena.getResidentBytes(); }
+
 		bool render(const Scene& scene);
 
 	private:
-		std::vector<MeshBuffers> createMeshBuffersList(const std::vector<Mesh>& meshes) const;
+		bool isEntityDrawn(const Frustum& frustum, const Transform& transform, const Appearance& appearance);
+
+		void bindPipeline(BindState& bindState, IGraphicsPipeline& pipeline);
+
+		void bindMeshPage(BindState& bindState, size_t pageIndex);
+
+		void addBindCounts(const BindState& bindState);
+
+		static GraphicsPipelineInitProps createPipelineInitProps(
+			const MaterialConfig& materialConfig,
+			GraphicsPipelineDepthMode depthMode
+		);
+
+		IGraphicsPipeline* getMaterialPipeline(
+			std::optional<size_t>& pipelineIndex,
+			const MaterialConfig& materialConfig,
+			GraphicsPipelineDepthMode depthMode
+		);
+
+		const MaterialDrawState& resolveMaterialDrawState(size_t materialIndex);
+
+		void gatherDirectDraws(const Scene& scene, const Matrix4& viewProjection);
+
+		// Lays down the depth of opaque draws, so that the shading of hidden fragments is rejected afterwards
+		void recordDepthPrePassCommands(BindState& bindState, std::span<const RenderQueueEntry> entries);
+
+		void recordDirectDrawCommands(BindState& bindState, std::span<const RenderQueueEntry> entries);
+
+		void recordDirectDraw(BindState& bindState, IGraphicsPipeline& pipeline, const DirectDraw& directDraw);
+
+		void recordParallelDirectDrawCommands(
+			const Scene& scene,
+			const Matrix4& viewProjection,
+			const SwapchainImageSize& swapchainImageSize
+		);
+
+		void recordInstancedDrawCommands(BindState& bindState, const Scene& scene, const Matrix4& viewProjection);
+
+		void recordCullingCommands(const Scene& scene, const Matrix4& viewProjection);
+
+		void recordGpuDrivenDrawCommands(BindState& bindState, const Matrix4& viewProjection);
 	};
 }
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <functional>
+#include <span>
 #include <optional>
+#include <vector>
 
 #include <Miracle/Common/IEcsContainer.hpp>
 #include <Miracle/Common/Models/EntityConfig.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Models/PrefabId.hpp>
+#include <Miracle/Common/Models/TransformConfig.hpp>
 #include <Miracle/Common/Components/Transform.hpp>
 #include <Miracle/Common/Components/Camera.hpp>
 #include <Miracle/Common/Components/Appearance.hpp>
@@ -20,24 +24,30 @@ namespace Miracle::Application {
 
 		virtual EntityId createEntity(const EntityConfig& config) = 0;
 
-		virtual void destroyScheduledEntities() = 0;
+		virtual std::vector<EntityId> createEntities(const EntityConfig& prototype, size_t count) = 0;
 
-		virtual void setEntityCreatedCallback(std::function<void(EntityId)>&& entityCreatedCallback) = 0;
+		virtual std::vector<EntityId> createEntities(std::span<const EntityConfig> configs) = 0;
 
-		virtual void unsetEntityCreatedCallback() = 0;
+		virtual void scheduleEntitiesDestruction(std::span<const EntityId> entities) = 0;
 
-		virtual void setEntityDestroyedCallback(std::function<void(EntityId)>&& entityDestroyedCallback) = 0;
+		virtual size_t getPrefabCount() const = 0;
 
-		virtual void unsetEntityDestroyedCallback() = 0;
+		virtual PrefabId registerPrefab(const EntityConfig& config) = 0;
 
-		virtual void forEachCamera(
-			const std::function<void(const Transform&, const Camera&)>& forEach
-		) const = 0;
+		virtual EntityId instantiatePrefab(PrefabId prefabId) = 0;
 
-		virtual void forEachAppearance(
-			const std::function<void(const Transform&, const Appearance&)>& forEach
-		) const = 0;
+		virtual EntityId instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig) = 0;
+
+		virtual std::vector<EntityId> instantiatePrefabs(PrefabId prefabId, size_t count) = 0;
+
+		virtual void destroyScheduledEntities() = 0;
 
-		virtual void forEachBehavior(const std::function<void(BehaviorBase&)>& forEach) = 0;
+		virtual void setEntityCreatedCallback(std::function<void(std::span<const EntityId>)>&& entityCreatedCallback) = 0;
+
+		virtual void unsetEntityCreatedCallback() = 0;
+
+		virtual void setEntityDestroyedCallback(std::function<void(std::span<const EntityId>)>&& entityDestroyedCallback) = 0;
+
+		virtual void unsetEntityDestroyedCallback() = 0;
 	};
 }
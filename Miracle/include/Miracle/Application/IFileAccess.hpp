@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <span>
 #include <vector>
 #include <string>
 #include <filesystem>
@@ -12,7 +13,14 @@ namespace Miracle::Application {
 	public:
 		virtual ~IFileAccess() = default;
 
+		virtual bool fileExists(const std::filesystem::path& filePath) const = 0;
+
 		virtual std::vector<std::byte> readFileAsBinary(const std::filesystem::path& filePath) const = 0;
+
+		virtual void writeFileAsBinary(
+			const std::filesystem::path& filePath,
+			std::span<const std::byte> data
+		) const = 0;
 	};
 
 	namespace FileAccessErrors {
@@ -31,5 +39,13 @@ namespace Miracle::Application {
 				std::string("Could not open file: ") + filePath.string()
 			) {}
 		};
+
+		class UnableToWriteFileError : public FileAccessError {
+		public:
+			UnableToWriteFileError(const std::filesystem::path& filePath) : FileAccessError(
+				FileAccessError::ErrorValue::unableToWriteFileError,
+				std::string("Could not write file: ") + filePath.string()
+			) {}
+		};
 	}
 }
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Miracle::Application {
+	using Job = std::function<void()>;
+	using ParallelForJob = std::function<void(size_t index)>;
+
+	// Tracks a group of scheduled jobs, which can be waited on or depended upon. Must outlive its jobs
+	class JobCounter {
+	private:
+		friend class JobSystem;
+
+		struct Continuation {
+			Job job;
+			JobCounter* counter = nullptr;
+		};
+
+		std::atomic<size_t> m_pendingJobCount = 0;
+		std::mutex m_mutex;
+		std::vector<Continuation> m_continuations;
+		std::exception_ptr m_jobException = nullptr;
+
+	public:
+		bool isDone() const { return m_pendingJobCount.load(std::memory_order_acquire) == 0; }
+	};
+
+	// Each thread owns a queue it runs jobs from, and steals from the other queues once its own is empty
+	class JobSystem {
+	private:
+		struct QueuedJob {
+			Job job;
+			JobCounter* counter = nullptr;
+		};
+
+		struct JobQueue {
+			std::mutex mutex;
+			std::deque<QueuedJob> jobs;
+		};
+
+		static constexpr size_t s_noQueueIndex = static_cast<size_t>(-1);
+		static constexpr size_t s_mainThreadQueueIndex = 0;
+		static constexpr size_t s_parallelForJobsPerThread = 4;
+
+		static thread_local size_t s_queueIndex;
+
+		std::vector<std::unique_ptr<JobQueue>> m_queues;
+		std::vector<std::thread> m_threads;
+		std::atomic<size_t> m_queuedJobCount = 0;
+		std::atomic<size_t> m_nextForeignQueueIndex = 0;
+
+		std::mutex m_mainThreadJobsMutex;
+		std::vector<QueuedJob> m_mainThreadJobs;
+		std::vector<QueuedJob> m_runningMainThreadJobs;
+
+		std::mutex m_backgroundJobsMutex;
+		std::deque<QueuedJob> m_backgroundJobs;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_jobsAvailableCondition;
+		bool m_stopping = false;
+
+	public:
+		// The constructing thread is regarded as the main thread
+		JobSystem(size_t workerThreadCount);
+
+		~JobSystem();
+
+		size_t getWorkerThreadCount() const { return m_threads.size(); }
+
+		bool isMainThread() const { return s_queueIndex == s_mainThreadQueueIndex; }
+
+		void schedule(Job&& job, JobCounter& counter);
+
+		// The job is scheduled once every job tracked by the dependency has completed
+		void scheduleAfter(JobCounter& dependency, Job&& job, JobCounter& counter);
+
+		// For long-running work that must not stall a frame. Only idle worker threads run it, never a thread that waits
+		void scheduleInBackground(Job&& job, JobCounter& counter);
+
+		// For work that has to happen on the main thread, such as windowing calls
+		void scheduleOnMainThread(Job&& job, JobCounter& counter);
+
+		// Runs jobs until the counter is done, then rethrows the first exception thrown by its jobs
+		void wait(JobCounter& counter);
+
+		// Blocks until the job has run for every index, with the calling thread taking part in running it
+		void parallelFor(size_t count, const ParallelForJob& job);
+
+		void runMainThreadJobs();
+
+	private:
+		void runWorker(size_t queueIndex);
+
+		void enqueue(QueuedJob&& queuedJob);
+
+		bool tryRunQueuedJob();
+
+		bool tryRunBackgroundJob();
+
+		void runJob(QueuedJob& queuedJob);
+
+		void completeJob(JobCounter& counter);
+	};
+}
@@ -34,7 +34,11 @@ namespace Miracle::Application {
 					.useVsync           = rendererConfig.swapchainConfig.useVsync,
 					.useTripleBuffering = rendererConfig.swapchainConfig.useTripleBuffering
 				},
-				.meshes               = rendererConfig.meshes
+				.renderingMode        = rendererConfig.renderingMode,
+				.recordingThreadCount = rendererConfig.recordingThreadCount,
+				.useDepthPrePass      = rendererConfig.useDepthPrePass,
+				.meshes               = rendererConfig.meshes,
+				.materials            = rendererConfig.materials
 			};
 		}
 
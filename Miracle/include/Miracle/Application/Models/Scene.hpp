@@ -1,37 +1,50 @@
 #pragma once
 
+#include <concepts>
 #include <memory>
 #include <vector>
 #include <functional>
+#include <span>
 #include <utility>
 #include <optional>
 
 #include <Miracle/Common/Math/ColorRgb.hpp>
 #include <Miracle/Common/Models/EntityConfig.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Models/SystemId.hpp>
+#include <Miracle/Common/Models/PrefabId.hpp>
+#include <Miracle/Common/Models/TransformConfig.hpp>
+#include <Miracle/Common/MiracleError.hpp>
 #include <Miracle/Common/EntityContext.hpp>
 #include <Miracle/Common/Components/Transform.hpp>
 #include <Miracle/Common/Components/Camera.hpp>
 #include <Miracle/Common/Components/Appearance.hpp>
 #include <Miracle/Application/IEcs.hpp>
 #include <Miracle/Application/IEcsContainer.hpp>
+#include <Miracle/Application/SystemScheduler.hpp>
+#include <Miracle/Application/TransformHierarchy.hpp>
+#include <Miracle/Application/JobSystem.hpp>
 
 namespace Miracle::Application {
 	struct SceneInitProps {
 		ColorRgb backgroundColor = {};
 		std::vector<EntityConfig> entityConfigs = {};
-		std::function<void(EntityId)> entityCreatedCallback = [](EntityId) {};
-		std::function<void(EntityId)> entityDestroyedCallback = [](EntityId) {};
+		std::function<void(std::span<const EntityId>)> entityCreatedCallback = [](std::span<const EntityId>) {};
+		std::function<void(std::span<const EntityId>)> entityDestroyedCallback = [](std::span<const EntityId>) {};
 	};
 
 	class Scene {
 	private:
 		std::unique_ptr<IEcsContainer> m_container;
 		ColorRgb m_backgroundColor;
+		SystemScheduler m_systemScheduler;
+		TransformHierarchy m_transformHierarchy;
+		uint32_t m_nextSystemId = 0;
 
 	public:
 		Scene(
 			IEcs& ecs,
+			JobSystem& jobSystem,
 			const SceneInitProps& initProps
 		);
 
@@ -45,11 +58,33 @@ namespace Miracle::Application {
 
 		EntityContext createAndGetEntity(const EntityConfig& config);
 
+		// Batches invoke the entity created callback once, with every created entity
+		std::vector<EntityId> createEntities(const EntityConfig& prototype, size_t count);
+
+		std::vector<EntityId> createEntities(std::span<const EntityConfig> configs);
+
 		void scheduleEntityDestruction(EntityId entity);
 
+		void scheduleEntitiesDestruction(std::span<const EntityId> entities);
+
+		// The config is resolved into components once, which every instance of the prefab is then copied from
+		PrefabId registerPrefab(const EntityConfig& config);
+
+		EntityContext instantiatePrefab(PrefabId prefabId);
+
+		EntityContext instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig);
+
+		std::vector<EntityId> instantiatePrefabs(PrefabId prefabId, size_t count);
+
+		// The transform of the child becomes relative to the parent. Children of a destroyed parent are left in place
+		// relative to the scene instead
+		void setParent(EntityId child, EntityId parent);
+
+		void removeParent(EntityId child);
+
 		void destroyScheduledEntities();
 
-		void setEntityCreatedCallback(std::function<void(EntityId)>&& entityCreatedCallback) {
+		void setEntityCreatedCallback(std::function<void(std::span<const EntityId>)>&& entityCreatedCallback) {
 			m_container->setEntityCreatedCallback(std::move(entityCreatedCallback));
 		}
 
@@ -57,7 +92,7 @@ namespace Miracle::Application {
 			m_container->unsetEntityCreatedCallback();
 		}
 
-		void setEntityDestroyedCallback(std::function<void(EntityId)>&& entityDestroyedCallback) {
+		void setEntityDestroyedCallback(std::function<void(std::span<const EntityId>)>&& entityDestroyedCallback) {
 			m_container->setEntityDestroyedCallback(std::move(entityDestroyedCallback));
 		}
 
@@ -65,14 +100,76 @@ namespace Miracle::Application {
 			m_container->unsetEntityDestroyedCallback();
 		}
 
-		void forEachEntityCamera(
-			const std::function<void(const Transform&, const Camera&)>& forEach
-		) const;
+		// Iterates the component storage directly, so the callable is inlined into the loop
+		template<typename... Components, typename ForEach>
+		void forEachEntity(ForEach&& forEach) {
+			m_container->getRegistry().view<Components...>().each(std::forward<ForEach>(forEach));
+		}
+
+		template<typename... Components, typename ForEach>
+		void forEachEntity(ForEach&& forEach) const {
+			m_container->getRegistry().view<Components...>().each(std::forward<ForEach>(forEach));
+		}
+
+		template<typename... Components>
+		auto getEntityView() { return m_container->getRegistry().view<Components...>(); }
 
-		void forEachEntityAppearance(
-			const std::function<void(const Transform&, const Appearance&)>& forEach
-		) const;
+		template<typename... Components>
+		auto getEntityView() const { return m_container->getRegistry().view<Components...>(); }
+
+		template<std::invocable<const Transform&, const Camera&> ForEach>
+		void forEachEntityCamera(ForEach&& forEach) const {
+			forEachEntity<Transform, Camera>(std::forward<ForEach>(forEach));
+		}
+
+		template<std::invocable<const Transform&, const Appearance&> ForEach>
+		void forEachEntityAppearance(ForEach&& forEach) const {
+			forEachEntity<Transform, Appearance>(std::forward<ForEach>(forEach));
+		}
+
+		// Systems update before behaviors and are called once per matching entity, with components declared const
+		// only being read. Systems conflicting over a component update in the order they were added
+		template<typename... Components, typename SystemFunction>
+		SystemId addSystem(SystemFunction&& systemFunction) {
+			auto systemId = SystemId(m_nextSystemId++);
+
+			m_systemScheduler.addSystem<Components...>(systemId, std::forward<SystemFunction>(systemFunction));
+
+			return systemId;
+		}
+
+		// Must not be called from within a system
+		void removeSystem(SystemId systemId);
 
 		void update();
+
+	private:
+		void validatePrefabRegistered(PrefabId prefabId) const;
 	};
+
+	namespace SceneErrors {
+		class PrefabNotRegisteredError : public SceneError {
+		public:
+			PrefabNotRegisteredError() : SceneError(
+				SceneError::ErrorValue::prefabNotRegisteredError,
+				"No prefab is registered with the given prefab ID"
+			) {}
+		};
+
+		class InvalidParentError : public SceneError {
+		public:
+			InvalidParentError() : SceneError(
+				SceneError::ErrorValue::invalidParentError,
+				"Entity cannot be parented to itself, to one of its descendants or to a destroyed entity"
+			) {}
+		};
+
+		class InvalidChildError : public SceneError {
+		public:
+			InvalidChildError() : SceneError(
+				SceneError::ErrorValue::invalidChildError,
+				"Only existing entities with a transform can be parented"
+			) {}
+		};
+	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
 
 #include "IMultimediaFramework.hpp"
@@ -17,6 +18,14 @@ namespace Miracle::Application {
 		int m_ups = 0;
 		int m_frameCounter = 0;
 		int m_updateCounter = 0;
+		size_t m_drawnEntityCount = 0;
+		size_t m_culledEntityCount = 0;
+		size_t m_lastFrameDrawnEntityCount = 0;
+		size_t m_lastFrameCulledEntityCount = 0;
+		size_t m_pipelineBindCount = 0;
+		size_t m_bufferBindCount = 0;
+		size_t m_lastFramePipelineBindCount = 0;
+		size_t m_lastFrameBufferBindCount = 0;
 		CountersUpdatedCallback m_callback = []() {};
 
 	public:
@@ -26,10 +35,22 @@ namespace Miracle::Application {
 
 		int getUps() const { return m_ups; }
 
+		size_t getDrawnEntityCount() const { return m_drawnEntityCount; }
+
+		size_t getCulledEntityCount() const { return m_culledEntityCount; }
+
+		size_t getPipelineBindCount() const { return m_pipelineBindCount; }
+
+		size_t getBufferBindCount() const { return m_bufferBindCount; }
+
 		void incrementFrameCounter();
 
 		void incrementUpdateCounter();
 
+		void setFrameEntityCounts(size_t drawnEntityCount, size_t culledEntityCount);
+
+		void setFrameBindCounts(size_t pipelineBindCount, size_t bufferBindCount);
+
 		void updateCounters();
 
 		void setCountersUpdatedCallback(CountersUpdatedCallback&& countersUpdatedCallback);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IEcs.hpp"
+#include "JobSystem.hpp"
 #include "Models/Scene.hpp"
 
 namespace Miracle::Application {
@@ -11,6 +12,7 @@ namespace Miracle::Application {
 	public:
 		SceneManager(
 			IEcs& ecs,
+			JobSystem& jobSystem,
 			const SceneInitProps& firstSceneInitProps
 		);
 
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Miracle/Common/EcsRegistry.hpp>
+#include <Miracle/Common/EntityCommandBuffer.hpp>
+#include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Models/SystemId.hpp>
+#include "IEcsContainer.hpp"
+#include "JobSystem.hpp"
+
+namespace Miracle::Application {
+	using ComponentTypeId = entt::id_type;
+
+	// Systems only reading a component (declared const) may run alongside each other, while a system writing it
+	// runs in a later stage than the systems added before it that access the same component
+	class SystemScheduler {
+	private:
+		struct System {
+			SystemId id = {};
+			std::vector<ComponentTypeId> readComponents;
+			std::vector<ComponentTypeId> writeComponents;
+			std::function<std::span<const EntityId>(EcsRegistry&)> getIteratedEntities;
+			std::function<void(EcsRegistry&, std::span<const EntityId>, EntityCommandBuffer&)> updateChunk;
+		};
+
+		struct Chunk {
+			size_t systemIndex = 0;
+			std::span<const EntityId> entities;
+		};
+
+		static constexpr size_t s_chunkEntityCount = 1024;
+
+		JobSystem& m_jobSystem;
+
+		std::vector<System> m_systems;
+		std::vector<std::vector<size_t>> m_stages;
+		bool m_stagesOutdated = false;
+		std::vector<Chunk> m_chunks;
+		std::vector<EntityCommandBuffer> m_commandBuffers;
+
+	public:
+		SystemScheduler(JobSystem& jobSystem);
+
+		size_t getSystemCount() const { return m_systems.size(); }
+
+		// The system function is called with the components of each matching entity, optionally preceded by the
+		// entity and a command buffer for structural changes. It runs concurrently, so it must only access the
+		// components it declares
+		template<typename... Components, typename SystemFunction>
+		void addSystem(SystemId systemId, SystemFunction&& systemFunction) {
+			m_systems.push_back(
+				System{
+					.id                  = systemId,
+					.readComponents      = getComponentTypeIds<Components...>(true),
+					.writeComponents     = getComponentTypeIds<Components...>(false),
+					.getIteratedEntities = [](EcsRegistry& registry) {
+						// Iterating the smallest storage visits the fewest entities lacking the other components
+						auto storages = std::array<const entt::basic_sparse_set<EntityId>*, sizeof...(Components)>{
+							&registry.storage<std::remove_const_t<Components>>()...
+						};
+
+						auto& leadingStorage = **std::ranges::min_element(
+							storages,
+							{},
+							[](const entt::basic_sparse_set<EntityId>* storage) { return storage->size(); }
+						);
+
+						return std::span<const EntityId>(leadingStorage.data(), leadingStorage.size());
+					},
+					.updateChunk         = [function = std::forward<SystemFunction>(systemFunction)](
+						EcsRegistry& registry,
+						std::span<const EntityId> entities,
+						EntityCommandBuffer& commandBuffer
+					) {
+						auto view = registry.view<Components...>();
+
+						for (auto entity : entities) {
+							if (!view.contains(entity)) continue;
+
+							if constexpr (std::invocable<const std::decay_t<SystemFunction>&, EntityCommandBuffer&, EntityId, Components&...>) {
+								function(commandBuffer, entity, view.template get<Components>(entity)...);
+							}
+							else if constexpr (std::invocable<const std::decay_t<SystemFunction>&, EntityId, Components&...>) {
+								function(entity, view.template get<Components>(entity)...);
+							}
+							else {
+								function(view.template get<Components>(entity)...);
+							}
+						}
+					}
+				}
+			);
+
+			m_stagesOutdated = true;
+		}
+
+		void removeSystem(SystemId systemId);
+
+		// Structural changes recorded by the systems are applied once every stage has completed
+		void update(IEcsContainer& container);
+
+	private:
+		template<typename... Components>
+		static std::vector<ComponentTypeId> getComponentTypeIds(bool readOnly) {
+			auto componentTypeIds = std::vector<ComponentTypeId>();
+
+			(
+				(std::is_const_v<Components> == readOnly
+					? componentTypeIds.push_back(entt::type_hash<std::remove_const_t<Components>>::value())
+					: void()),
+				...
+			);
+
+			return componentTypeIds;
+		}
+
+		static bool isConflicting(const System& system, const System& otherSystem);
+
+		void createStages();
+
+		void applyCommandBuffers(IEcsContainer& container, size_t commandBufferCount);
+	};
+}
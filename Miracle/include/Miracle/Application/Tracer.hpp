@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Miracle::Application {
+	struct TraceEvent {
+		const char* name = nullptr;
+		uint64_t beginTime = 0;
+		uint64_t duration = 0;
+	};
+
+	// Collects zone events in per-thread ring buffers, which are only ever written by their own thread
+	class Tracer {
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		// Fields are atomic, as a trace may be read from a slot while its thread overwrites it
+		struct TraceEventSlot {
+			std::atomic<const char*> name = nullptr;
+			std::atomic<uint64_t> beginTime = 0;
+			std::atomic<uint64_t> duration = 0;
+		};
+
+		struct ThreadBuffer {
+			uint32_t threadIndex = 0;
+			std::unique_ptr<TraceEventSlot[]> eventSlots;
+			std::atomic<uint64_t> writtenEventCount = 0;
+		};
+
+		static constexpr size_t s_threadEventCapacity = 64 * 1024;
+
+		static const Clock::time_point s_startTime;
+		static std::mutex s_threadBuffersMutex;
+		static std::vector<std::unique_ptr<ThreadBuffer>> s_threadBuffers;
+		static thread_local ThreadBuffer* s_currentThreadBuffer;
+
+	public:
+		Tracer() = delete;
+
+		// Nanoseconds since the tracer was started
+		static uint64_t getCurrentTime() {
+			return static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - s_startTime).count()
+			);
+		}
+
+		// The name has to outlive the tracer, like a string literal
+		static void addEvent(const char* name, uint64_t beginTime, uint64_t endTime);
+
+		// Creates a Chrome trace JSON document of the most recent events of every thread
+		static std::string createChromeTraceJson();
+
+	private:
+		static ThreadBuffer& registerCurrentThread();
+	};
+
+	class TraceZone {
+	private:
+		const char* m_name;
+		uint64_t m_beginTime;
+
+	public:
+		explicit TraceZone(const char* name) :
+			m_name(name),
+			m_beginTime(Tracer::getCurrentTime())
+		{}
+
+		TraceZone(const TraceZone&) = delete;
+
+		TraceZone& operator=(const TraceZone&) = delete;
+
+		~TraceZone() {
+			Tracer::addEvent(m_name, m_beginTime, Tracer::getCurrentTime());
+		}
+	};
+}
+
+/* ----- Tracing macros ----- */
+
+#ifdef MIRACLE_ENABLE_TRACING
+#define MIRACLE_TRACE_CONCATENATE_INNER(a, b) a##b
+#define MIRACLE_TRACE_CONCATENATE(a, b) MIRACLE_TRACE_CONCATENATE_INNER(a, b)
+#define MIRACLE_TRACE_ZONE(name) const ::Miracle::Application::TraceZone MIRACLE_TRACE_CONCATENATE(miracleTraceZone, __LINE__)(name)
+#else
+#define MIRACLE_TRACE_ZONE(name) ((void)0)
+#endif
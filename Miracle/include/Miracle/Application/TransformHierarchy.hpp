@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include <Miracle/Common/EcsRegistry.hpp>
+#include <Miracle/Common/TransformStore.hpp>
+#include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Components/Transform.hpp>
+#include <Miracle/Common/Components/TransformParent.hpp>
+
+namespace Miracle::Application {
+	// Updates world transforms of changed entities, and of every descendant of a changed entity
+	class TransformHierarchy {
+	private:
+		// Refers to transforms by their index in the transform store
+		struct ChildNode {
+			uint32_t transformIndex = 0;
+			uint32_t parentTransformIndex = 0;
+		};
+
+		EcsRegistry& m_registry;
+		TransformStore& m_transformStore;
+
+		std::vector<ChildNode> m_childNodes;
+		// Entities the child nodes have as parent, as only destroying those changes the hierarchy
+		std::unordered_set<EntityId> m_parentEntities;
+		bool m_childNodesOutdated = false;
+
+	public:
+		TransformHierarchy(EcsRegistry& registry, TransformStore& transformStore);
+
+		~TransformHierarchy();
+
+		TransformHierarchy(const TransformHierarchy&) = delete;
+
+		TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+		bool isDescendant(EntityId entity, EntityId ancestor) const;
+
+		void update();
+
+	private:
+		void onParentChanged(EcsRegistry& registry, EntityId entity);
+
+		void onTransformDestroyed(EcsRegistry& registry, EntityId entity);
+
+		void sortChildNodes();
+
+		void updateOutdatedTransformations();
+
+		void updateChildTransformations();
+
+		size_t findOutdatedIndex(size_t firstIndex, bool outdated) const;
+	};
+}
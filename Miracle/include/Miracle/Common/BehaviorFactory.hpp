@@ -5,28 +5,41 @@
 #include <utility>
 
 #include "Components/Behavior.hpp"
+#include "BehaviorPool.hpp"
 #include "EntityContext.hpp"
 
 namespace Miracle {
 	class BehaviorFactory {
 	private:
-		std::function<std::unique_ptr<BehaviorBase>(const EntityContext&)> m_factory;
+		std::function<BehaviorPointer(const EntityContext&)> m_factory;
 
 	public:
-		BehaviorFactory(std::function<std::unique_ptr<BehaviorBase>(const EntityContext&)> factory) :
+		BehaviorFactory(std::function<BehaviorPointer(const EntityContext&)> factory) :
 			m_factory(std::move(factory))
 		{}
 
-		std::unique_ptr<BehaviorBase> produce(const EntityContext& context) const {
+		// Behaviors produced by the given factory are heap allocated instead of pooled
+		BehaviorFactory(std::function<std::unique_ptr<BehaviorBase>(const EntityContext&)> factory) :
+			m_factory(
+				[factory = std::move(factory)](const EntityContext& context) {
+					BehaviorPoolBase::countUnpooledCreation();
+					return BehaviorPointer(factory(context).release());
+				}
+			)
+		{}
+
+		BehaviorPointer produce(const EntityContext& context) const {
 			return m_factory(context);
 		}
 
 		template<Behavior TBehavior, typename... TBehaviorArgs>
 		static BehaviorFactory createFactoryFor(TBehaviorArgs&&... behaviorArgs) {
 			return BehaviorFactory(
-				[=](const EntityContext& context) {
-					return std::make_unique<TBehavior>(context, behaviorArgs...);
-				}
+				std::function<BehaviorPointer(const EntityContext&)>(
+					[=](const EntityContext& context) {
+						return BehaviorPool<TBehavior>::getInstance().create(context, behaviorArgs...);
+					}
+				)
 			);
 		}
 	};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Components/Behavior.hpp"
+#include "Models/BehaviorAllocationCounters.hpp"
+
+namespace Miracle {
+	class BehaviorPoolBase {
+	protected:
+		static inline BehaviorAllocationCounters s_allocationCounters = {};
+
+	public:
+		static const BehaviorAllocationCounters& getAllocationCounters() { return s_allocationCounters; }
+
+		static void countUnpooledCreation() { s_allocationCounters.unpooledCreationCount++; }
+	};
+
+	// Behaviors of one type are allocated from pages of slots, with freed slots reused before a new page is allocated
+	template<Behavior TBehavior>
+	class BehaviorPool : public BehaviorPoolBase {
+	private:
+		union Slot {
+			Slot* nextFreeSlot;
+			alignas(TBehavior) std::byte storage[sizeof(TBehavior)];
+		};
+
+		static constexpr size_t s_slotsPerPage = 256;
+
+		std::vector<std::unique_ptr<Slot[]>> m_pages;
+		Slot* m_firstFreeSlot = nullptr;
+
+		BehaviorPool() = default;
+
+	public:
+		BehaviorPool(const BehaviorPool&) = delete;
+
+		BehaviorPool& operator=(const BehaviorPool&) = delete;
+
+		// Behaviors are only created and destroyed on the updating thread, so the pools are not synchronized
+		static BehaviorPool& getInstance() {
+			static BehaviorPool pool;
+			return pool;
+		}
+
+		template<typename... TBehaviorArgs>
+		BehaviorPointer create(TBehaviorArgs&&... behaviorArgs) {
+			auto slot = takeSlot();
+			TBehavior* behavior = nullptr;
+
+			try {
+				behavior = std::construct_at(
+					reinterpret_cast<TBehavior*>(slot->storage),
+					std::forward<TBehaviorArgs>(behaviorArgs)...
+				);
+			}
+			catch (...) {
+				returnSlot(slot);
+				throw;
+			}
+
+			s_allocationCounters.pooledCreationCount++;
+
+			return BehaviorPointer(behavior, BehaviorDeleter{ .destroy = &BehaviorPool::destroy });
+		}
+
+	private:
+		static void destroy(BehaviorBase* behavior) {
+			auto derivedBehavior = static_cast<TBehavior*>(behavior);
+
+			std::destroy_at(derivedBehavior);
+			getInstance().returnSlot(reinterpret_cast<Slot*>(derivedBehavior));
+
+			s_allocationCounters.pooledDestructionCount++;
+		}
+
+		Slot* takeSlot() {
+			if (m_firstFreeSlot == nullptr) [[unlikely]] {
+				auto& page = m_pages.emplace_back(std::make_unique<Slot[]>(s_slotsPerPage));
+
+				for (size_t i = 0; i < s_slotsPerPage; i++) {
+					page[i].nextFreeSlot = i + 1 < s_slotsPerPage ? &page[i + 1] : nullptr;
+				}
+
+				m_firstFreeSlot = &page[0];
+
+				s_allocationCounters.poolPageAllocationCount++;
+			}
+
+			return std::exchange(m_firstFreeSlot, m_firstFreeSlot->nextFreeSlot);
+		}
+
+		void returnSlot(Slot* slot) {
+			slot->nextFreeSlot = m_firstFreeSlot;
+			m_firstFreeSlot = slot;
+		}
+	};
+}
@@ -10,16 +10,19 @@ namespace Miracle {
 		bool m_visible;
 		size_t m_meshIndex;
 		ColorRgb m_color;
+		size_t m_materialIndex;
 
 	public:
 		Appearance(
 			bool visible,
 			size_t meshIndex,
-			ColorRgb color
+			ColorRgb color,
+			size_t materialIndex
 		) :
 			m_visible(visible),
 			m_meshIndex(meshIndex),
-			m_color(color)
+			m_color(color),
+			m_materialIndex(materialIndex)
 		{}
 
 		constexpr bool isVisible() const { return m_visible; }
@@ -33,5 +36,9 @@ namespace Miracle {
 		constexpr const ColorRgb& getColor() const { return m_color; }
 
 		constexpr void setColor(const ColorRgb& color) { m_color = color; }
+
+		constexpr size_t getMaterialIndex() const { return m_materialIndex; }
+
+		constexpr void setMaterialIndex(size_t materialIndex) { m_materialIndex = materialIndex; }
 	};
 }
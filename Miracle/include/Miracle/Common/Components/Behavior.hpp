@@ -1,6 +1,7 @@
 #pragma once
 
 #include <concepts>
+#include <memory>
 
 #include <Miracle/Common/EntityContext.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
@@ -23,4 +24,13 @@ namespace Miracle {
 
 	template<typename T>
 	concept Behavior = std::derived_from<T, BehaviorBase>;
+
+	// Returns a behavior to wherever it was allocated from
+	struct BehaviorDeleter {
+		void (*destroy)(BehaviorBase* behavior) = [](BehaviorBase* behavior) { delete behavior; };
+
+		void operator()(BehaviorBase* behavior) const { destroy(behavior); }
+	};
+
+	using BehaviorPointer = std::unique_ptr<BehaviorBase, BehaviorDeleter>;
 }
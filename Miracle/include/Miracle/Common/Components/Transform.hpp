@@ -1,122 +1,157 @@
 #pragma once
 
 #include <cstdint>
+#include <utility>
 
+#include <Miracle/Common/TransformStore.hpp>
 #include <Miracle/Common/Math/Vector3.hpp>
 #include <Miracle/Common/Math/Matrix4.hpp>
 #include <Miracle/Common/Math/Quaternion.hpp>
 #include <Miracle/Common/Math/MathUtilities.hpp>
 
+namespace Miracle::Application {
+	class TransformHierarchy;
+}
+
 namespace Miracle {
 	enum class TransformSpace : uint8_t {
 		local,
 		scene
 	};
 
+	// Relative to the parent of the entity, if it has one. The values are kept in the transform store of the scene
 	class Transform {
 	private:
-		Vector3 m_translation;
-		Quaternion m_rotation;
-		Vector3 m_scale;
+		friend class Application::TransformHierarchy;
 
-		mutable Matrix4 m_cachedTransformation;
-		mutable bool m_cacheOutdated = false;
+		TransformStore* m_store;
+		uint32_t m_index;
 
 	public:
-		constexpr Transform(
+		Transform(
+			TransformStore& store,
 			const Vector3& translation,
 			const Quaternion& rotation,
 			const Vector3& scale
 		) :
-			m_translation(translation),
-			m_rotation(rotation),
-			m_scale(scale),
-			m_cachedTransformation(createTransformation())
+			m_store(&store),
+			m_index(store.allocate(translation, rotation, scale))
+		{}
+
+		Transform(const Transform&) = delete;
+
+		Transform(Transform&& transform) noexcept :
+			m_store(std::exchange(transform.m_store, nullptr)),
+			m_index(transform.m_index)
 		{}
 
-		constexpr const Vector3& getTranslation() const { return m_translation; }
+		~Transform() {
+			if (m_store != nullptr) {
+				m_store->release(m_index);
+			}
+		}
+
+		Transform& operator=(const Transform&) = delete;
+
+		Transform& operator=(Transform&& transform) noexcept {
+			if (this == &transform) return *this;
+
+			if (m_store != nullptr) {
+				m_store->release(m_index);
+			}
+
+			m_store = std::exchange(transform.m_store, nullptr);
+			m_index = transform.m_index;
+
+			return *this;
+		}
+
+		const Vector3& getTranslation() const { return m_store->getTranslation(m_index); }
 
-		constexpr void setTranslation(const Vector3& translation) {
-			m_translation = translation;
-			m_cacheOutdated = true;
+		void setTranslation(const Vector3& translation) {
+			m_store->getTranslation(m_index) = translation;
+			m_store->markOutdated(m_index);
 		}
 
 		template<TransformSpace transformSpace = TransformSpace::local>
 		void translate(const Vector3& deltaTranslation) {
 			if constexpr (transformSpace == TransformSpace::local) {
-				m_translation += MathUtilities::rotateVector(deltaTranslation, m_rotation);
+				m_store->getTranslation(m_index) += MathUtilities::rotateVector(
+					deltaTranslation,
+					m_store->getRotation(m_index)
+				);
 			}
 			else {
-				m_translation += deltaTranslation;
+				m_store->getTranslation(m_index) += deltaTranslation;
 			}
 
-			m_cacheOutdated = true;
+			m_store->markOutdated(m_index);
 		}
 
 		void translate(const Vector3& deltaTranslation, TransformSpace transformSpace) {
-			m_translation += transformSpace == TransformSpace::local
-				? MathUtilities::rotateVector(deltaTranslation, m_rotation)
+			m_store->getTranslation(m_index) += transformSpace == TransformSpace::local
+				? MathUtilities::rotateVector(deltaTranslation, m_store->getRotation(m_index))
 				: deltaTranslation;
 
-			m_cacheOutdated = true;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr const Quaternion& getRotation() const { return m_rotation; }
+		const Quaternion& getRotation() const { return m_store->getRotation(m_index); }
 
-		constexpr void setRotation(const Quaternion& rotation) {
-			m_rotation = rotation;
-			m_cacheOutdated = true;
+		void setRotation(const Quaternion& rotation) {
+			m_store->getRotation(m_index) = rotation;
+			m_store->markOutdated(m_index);
 		}
 
 		template<TransformSpace transformSpace = TransformSpace::local>
-		constexpr void rotate(const Quaternion& deltaRotation) {
+		void rotate(const Quaternion& deltaRotation) {
+			auto& rotation = m_store->getRotation(m_index);
+
 			if constexpr (transformSpace == TransformSpace::local) {
-				m_rotation = m_rotation * deltaRotation;
+				rotation = rotation * deltaRotation;
 			}
 			else {
-				m_rotation = deltaRotation * m_rotation;
+				rotation = deltaRotation * rotation;
 			}
 
-			m_cacheOutdated = true;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr void rotate(const Quaternion& deltaRotation, TransformSpace transformSpace) {
-			m_rotation = transformSpace == TransformSpace::local
-				? m_rotation * deltaRotation
-				: deltaRotation * m_rotation;
+		void rotate(const Quaternion& deltaRotation, TransformSpace transformSpace) {
+			auto& rotation = m_store->getRotation(m_index);
+
+			rotation = transformSpace == TransformSpace::local
+				? rotation * deltaRotation
+				: deltaRotation * rotation;
 
-			m_cacheOutdated = true;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr const Vector3& getScale() const { return m_scale; }
+		const Vector3& getScale() const { return m_store->getScale(m_index); }
 
-		constexpr void setScale(const Vector3& scale) {
-			m_scale = scale;
-			m_cacheOutdated = true;
+		void setScale(const Vector3& scale) {
+			m_store->getScale(m_index) = scale;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr void scale(const Vector3& deltaScale) {
-			m_scale += deltaScale;
-			m_cacheOutdated = true;
+		void scale(const Vector3& deltaScale) {
+			m_store->getScale(m_index) += deltaScale;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr void scale(float scalar) {
-			m_scale *= scalar;
-			m_cacheOutdated = true;
+		void scale(float scalar) {
+			m_store->getScale(m_index) *= scalar;
+			m_store->markOutdated(m_index);
 		}
 
-		constexpr const Matrix4& getTransformation() const {
-			if (m_cacheOutdated) {
-				m_cachedTransformation = createTransformation();
-				m_cacheOutdated = false;
-			}
+		// Whether the transform has changed since the world transformation was last updated from it
+		bool isOutdated() const { return m_store->isOutdated(m_index); }
 
-			return m_cachedTransformation;
-		}
+		// Transformation from the space of the entity to scene space, updated from the transform hierarchy once per update
+		const Matrix4& getWorldTransformation() const { return m_store->getWorldTransformation(m_index); }
 
-	private:
-		constexpr Matrix4 createTransformation() const {
-			return Matrix4::createTransformation(m_translation, m_rotation, m_scale);
+		Matrix4 createTransformation() const {
+			return Matrix4::createTransformation(getTranslation(), getRotation(), getScale());
 		}
 	};
 }
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Miracle/Common/Models/EntityId.hpp>
+
+namespace Miracle {
+	class TransformParent {
+	private:
+		EntityId m_parent;
+
+	public:
+		constexpr TransformParent(EntityId parent) :
+			m_parent(parent)
+		{}
+
+		constexpr EntityId getParent() const { return m_parent; }
+	};
+}
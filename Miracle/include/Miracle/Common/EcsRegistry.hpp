@@ -0,0 +1,10 @@
+#pragma once
+
+#include <entt/entity/registry.hpp>
+
+#include "Models/EntityId.hpp"
+
+namespace Miracle {
+	// Shared with the ECS backend, so that scene iteration can be inlined over the component storage
+	using EcsRegistry = entt::basic_registry<EntityId>;
+}
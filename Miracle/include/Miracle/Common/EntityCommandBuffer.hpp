@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "Models/EntityConfig.hpp"
+#include "Models/EntityId.hpp"
+
+namespace Miracle {
+	// Records structural changes made while systems run, to be applied once every system has completed
+	class EntityCommandBuffer {
+	private:
+		std::vector<EntityConfig> m_createdEntityConfigs;
+		std::vector<EntityId> m_destroyedEntities;
+
+	public:
+		const std::vector<EntityConfig>& getCreatedEntityConfigs() const { return m_createdEntityConfigs; }
+
+		const std::vector<EntityId>& getDestroyedEntities() const { return m_destroyedEntities; }
+
+		bool isEmpty() const { return m_createdEntityConfigs.empty() && m_destroyedEntities.empty(); }
+
+		void createEntity(const EntityConfig& config) { m_createdEntityConfigs.push_back(config); }
+
+		void destroyEntity(EntityId entity) { m_destroyedEntities.push_back(entity); }
+
+		void clear() {
+			m_createdEntityConfigs.clear();
+			m_destroyedEntities.clear();
+		}
+	};
+}
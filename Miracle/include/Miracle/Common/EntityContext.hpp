@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include "IEcsContainer.hpp"
 #include "Models/EntityId.hpp"
 #include "Components/Transform.hpp"
@@ -33,5 +35,26 @@ namespace Miracle {
 		Appearance& getAppearance() { return m_ecsContainer.getAppearance(m_entityId); }
 
 		const Appearance& getAppearance() const { return m_ecsContainer.getAppearance(m_entityId); }
+
+		// Adds a user defined component, which systems can then iterate together with the built-in ones
+		template<typename Component, typename... ComponentArgs>
+		Component& addComponent(ComponentArgs&&... componentArgs) {
+			return m_ecsContainer.getRegistry().emplace<Component>(
+				m_entityId,
+				std::forward<ComponentArgs>(componentArgs)...
+			);
+		}
+
+		template<typename Component>
+		bool hasComponent() const { return m_ecsContainer.getRegistry().all_of<Component>(m_entityId); }
+
+		template<typename Component>
+		Component& getComponent() { return m_ecsContainer.getRegistry().get<Component>(m_entityId); }
+
+		template<typename Component>
+		const Component& getComponent() const { return m_ecsContainer.getRegistry().get<Component>(m_entityId); }
+
+		template<typename Component>
+		void removeComponent() { m_ecsContainer.getRegistry().remove<Component>(m_entityId); }
 	};
 }
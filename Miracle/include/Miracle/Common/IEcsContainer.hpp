@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Miracle/Common/EcsRegistry.hpp>
+#include <Miracle/Common/TransformStore.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
 #include <Miracle/Common/Components/Transform.hpp>
 #include <Miracle/Common/Components/Camera.hpp>
@@ -23,5 +25,11 @@ namespace Miracle {
 		virtual Appearance& getAppearance(EntityId entity) = 0;
 
 		virtual const Appearance& getAppearance(EntityId entity) const = 0;
+
+		virtual EcsRegistry& getRegistry() = 0;
+
+		virtual const EcsRegistry& getRegistry() const = 0;
+
+		virtual TransformStore& getTransformStore() = 0;
 	};
 }
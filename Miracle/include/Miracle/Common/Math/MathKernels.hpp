@@ -0,0 +1,54 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "Matrix4.hpp"
+
+namespace Miracle {
+	// Vectorized versions of the hot math operations, using AVX2 or SSE2 when built for them and scalar code otherwise
+	class MathKernels {
+	public:
+		MathKernels() = delete;
+
+		static std::string_view getInstructionSet();
+
+		static Matrix4 multiply(const Matrix4& lhs, const Matrix4& rhs);
+
+		// The rotation has to be normalized
+		static Matrix4 createTransformation(
+			const Vector3& translation,
+			const Quaternion& rotation,
+			const Vector3& scale
+		);
+
+		// The rotation has to be normalized
+		static Vector3 rotateVector(const Vector3& vector, const Quaternion& rotation);
+
+		static Vector3 toNormalized(const Vector3& vector);
+
+		/* ----- BATCHES ----- */
+
+		// Results may be the same span as the left hand sides
+		static void multiply(std::span<const Matrix4> lhs, const Matrix4& rhs, std::span<Matrix4> results);
+
+		// The rotations have to be normalized
+		static void createTransformations(
+			std::span<const Vector3> translations,
+			std::span<const Quaternion> rotations,
+			std::span<const Vector3> scales,
+			std::span<Matrix4> results
+		);
+
+		// Results may be the same span as the vectors, the rotation has to be normalized
+		static void rotateVectors(
+			std::span<const Vector3> vectors,
+			const Quaternion& rotation,
+			std::span<Vector3> results
+		);
+
+		static void normalize(std::span<Vector3> vectors);
+	};
+}
@@ -21,7 +21,10 @@ namespace Miracle {
 		renderPass,
 		graphicsPipeline,
 		vertexBuffer,
-		indexBuffer
+		indexBuffer,
+		meshArena,
+		cullingPipeline,
+		scene
 	};
 
 	class MiracleError : public std::runtime_error {
@@ -62,7 +65,8 @@ namespace Miracle {
 	public:
 		enum class ErrorValue : Miracle::ErrorValue {
 			fileDoesNotExistError,
-			unableToOpenFileError
+			unableToOpenFileError,
+			unableToWriteFileError
 		};
 
 		FileAccessError(ErrorValue errorValue, const std::string& message) : MiracleError(
@@ -105,7 +109,9 @@ namespace Miracle {
 			debugToolsUnavailableError,
 			functionalityNotSupportedError,
 			graphicsDeviceNotFoundError,
-			noGraphicsDeviceSupportedError
+			noGraphicsDeviceSupportedError,
+			frameAllocationError,
+			uploadError
 		};
 
 		GraphicsContextError(ErrorValue errorValue, const std::string& message) : MiracleError(
@@ -118,7 +124,8 @@ namespace Miracle {
 	class SwapchainError : public MiracleError {
 	public:
 		enum class ErrorValue : Miracle::ErrorValue {
-			creationError
+			creationError,
+			readbackError
 		};
 
 		SwapchainError(ErrorValue errorValue, const std::string& message) : MiracleError(
@@ -181,4 +188,46 @@ namespace Miracle {
 			message
 		) {}
 	};
+
+	class MeshArenaError : public MiracleError {
+	public:
+		enum class ErrorValue : Miracle::ErrorValue {
+			emptyMeshError,
+			meshNotLoadedError
+		};
+
+		MeshArenaError(ErrorValue errorValue, const std::string& message) : MiracleError(
+			ErrorCategory::meshArena,
+			static_cast<Miracle::ErrorValue>(errorValue),
+			message
+		) {}
+	};
+
+	class CullingPipelineError : public MiracleError {
+	public:
+		enum class ErrorValue : Miracle::ErrorValue {
+			creationError
+		};
+
+		CullingPipelineError(ErrorValue errorValue, const std::string& message) : MiracleError(
+			ErrorCategory::cullingPipeline,
+			static_cast<Miracle::ErrorValue>(errorValue),
+			message
+		) {}
+	};
+
+	class SceneError : public MiracleError {
+	public:
+		enum class ErrorValue : Miracle::ErrorValue {
+			prefabNotRegisteredError,
+			invalidParentError,
+			invalidChildError
+		};
+
+		SceneError(ErrorValue errorValue, const std::string& message) : MiracleError(
+			ErrorCategory::scene,
+			static_cast<Miracle::ErrorValue>(errorValue),
+			message
+		) {}
+	};
 }
@@ -9,5 +9,6 @@ namespace Miracle {
 		bool visible = true;
 		size_t meshIndex = 0;
 		ColorRgb color = ColorRgb::createFromNonlinearSrgbColorCode(0xBFBFBF);
+		size_t materialIndex = 0;
 	};
 }
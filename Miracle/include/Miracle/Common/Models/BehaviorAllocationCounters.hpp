@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Miracle {
+	struct BehaviorAllocationCounters {
+		size_t pooledCreationCount = 0;
+		size_t pooledDestructionCount = 0;
+		size_t poolPageAllocationCount = 0;
+		size_t unpooledCreationCount = 0;
+	};
+}
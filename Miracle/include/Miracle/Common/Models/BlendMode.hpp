@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	enum class BlendMode : uint8_t {
+		opaque,
+		additive
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	// Faces are front facing when their vertices appear counter-clockwise
+	enum class CullMode : uint8_t {
+		none,
+		back,
+		front
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	enum class FramePhase : uint8_t {
+		eventProcessing,
+		updateScript,
+		entityDestruction,
+		sceneUpdate,
+		renderRecording,
+		renderSubmission,
+		presentation,
+		gpuRenderPass
+	};
+}
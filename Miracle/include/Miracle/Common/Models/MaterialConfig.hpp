@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "CullMode.hpp"
+#include "BlendMode.hpp"
+
+namespace Miracle {
+	// Materials apply to direct draws, as instanced draws are batched per mesh with their own shaders
+	struct MaterialConfig {
+		// Has to declare gl_Position invariant when used with the depth pre-pass
+		std::filesystem::path vertexShaderPath = "Assets/Shaders/Default.vert.spv";
+		std::filesystem::path fragmentShaderPath = "Assets/Shaders/Default.frag.spv";
+		CullMode cullMode = CullMode::none;
+		BlendMode blendMode = BlendMode::opaque;
+		bool depthTest = true;
+		// Only applies when depth is tested
+		bool depthWrite = true;
+		// Values of the shader specialization constants, by constant ID
+		std::vector<uint32_t> specializationConstants = {};
+	};
+}
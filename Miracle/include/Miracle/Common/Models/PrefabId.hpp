@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	enum class PrefabId : uint32_t {};
+}
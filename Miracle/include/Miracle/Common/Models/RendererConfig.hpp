@@ -1,13 +1,22 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include "SwapchainConfig.hpp"
+#include "RenderingMode.hpp"
 #include "Mesh.hpp"
+#include "MaterialConfig.hpp"
 
 namespace Miracle {
 	struct RendererConfig {
 		SwapchainConfig swapchainConfig = {};
+		RenderingMode renderingMode = RenderingMode::direct;
+		size_t recordingThreadCount = 1;
+		// Direct draws lay down depth first, so only the visible fragment of each pixel is shaded
+		bool useDepthPrePass = false;
 		std::vector<Mesh> meshes = {};
+		// A default material is used when none are given
+		std::vector<MaterialConfig> materials = {};
 	};
 }
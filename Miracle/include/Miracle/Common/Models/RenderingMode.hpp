@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	enum class RenderingMode : uint8_t {
+		direct,
+		instanced,
+		gpuDriven
+	};
+}
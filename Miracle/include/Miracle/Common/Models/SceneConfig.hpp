@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <functional>
+#include <span>
 
 #include <Miracle/Common/Math/ColorRgb.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
@@ -11,7 +12,7 @@ namespace Miracle {
 	struct SceneConfig {
 		ColorRgb backgroundColor = ColorRgb::createFromNonlinearSrgbColorCode(0x202020);
 		std::vector<EntityConfig> entityConfigs = {};
-		std::function<void(EntityId)> entityCreatedCallback = [](EntityId) {};
-		std::function<void(EntityId)> entityDestroyedCallback = [](EntityId) {};
+		std::function<void(std::span<const EntityId>)> entityCreatedCallback = [](std::span<const EntityId>) {};
+		std::function<void(std::span<const EntityId>)> entityDestroyedCallback = [](std::span<const EntityId>) {};
 	};
 }
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Miracle {
+	enum class SystemId : uint32_t {};
+}
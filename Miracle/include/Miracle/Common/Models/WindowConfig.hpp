@@ -13,5 +13,8 @@ namespace Miracle {
 			.height = 480
 		};
 		bool resizable = false;
+
+		// Renders into offscreen images of the window size instead of presenting to a visible window
+		bool headless = false;
 	};
 }
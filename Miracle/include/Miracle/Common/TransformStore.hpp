@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Miracle/Common/Math/Vector3.hpp>
+#include <Miracle/Common/Math/Quaternion.hpp>
+#include <Miracle/Common/Math/Matrix4.hpp>
+
+namespace Miracle::Application {
+	class TransformHierarchy;
+}
+
+namespace Miracle {
+	class Transform;
+
+	// Values of all transforms of a scene, each kept in its own packed array and addressed by the index held by a Transform.
+	// The arrays are split into pages that are never moved, so references to values stay valid as transforms are added
+	class TransformStore {
+	private:
+		friend class Transform;
+		friend class Application::TransformHierarchy;
+
+		static constexpr size_t s_bitsPerWord = 64;
+		static constexpr size_t s_pageSize = 16 * s_bitsPerWord;
+
+		struct Page {
+			std::array<Vector3, s_pageSize> translations;
+			std::array<Quaternion, s_pageSize> rotations;
+			std::array<Vector3, s_pageSize> scales;
+			std::array<Matrix4, s_pageSize> worldTransformations;
+		};
+
+		std::vector<std::unique_ptr<Page>> m_pages;
+		size_t m_capacity = 0;
+		std::vector<uint64_t> m_outdatedBits;
+		std::vector<uint32_t> m_freeIndices;
+
+	public:
+		TransformStore() = default;
+
+		TransformStore(const TransformStore&) = delete;
+
+		TransformStore& operator=(const TransformStore&) = delete;
+
+		size_t getCapacity() const { return m_capacity; }
+
+		size_t getTransformCount() const { return m_capacity - m_freeIndices.size(); }
+
+	private:
+		uint32_t allocate(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) {
+			uint32_t index = 0;
+
+			if (!m_freeIndices.empty()) {
+				index = m_freeIndices.back();
+				m_freeIndices.pop_back();
+			}
+			else {
+				index = static_cast<uint32_t>(m_capacity++);
+
+				if (index % s_pageSize == 0) {
+					m_pages.push_back(std::make_unique<Page>());
+				}
+
+				if (index % s_bitsPerWord == 0) {
+					m_outdatedBits.push_back(0);
+				}
+			}
+
+			getTranslation(index) = translation;
+			getRotation(index) = rotation;
+			getScale(index) = scale;
+			getWorldTransformation(index) = Matrix4s::identity;
+
+			markOutdated(index);
+
+			return index;
+		}
+
+		void release(uint32_t index) {
+			m_outdatedBits[index / s_bitsPerWord] &= ~getBit(index);
+			m_freeIndices.push_back(index);
+		}
+
+		Vector3& getTranslation(uint32_t index) { return m_pages[index / s_pageSize]->translations[index % s_pageSize]; }
+
+		Quaternion& getRotation(uint32_t index) { return m_pages[index / s_pageSize]->rotations[index % s_pageSize]; }
+
+		Vector3& getScale(uint32_t index) { return m_pages[index / s_pageSize]->scales[index % s_pageSize]; }
+
+		Matrix4& getWorldTransformation(uint32_t index) {
+			return m_pages[index / s_pageSize]->worldTransformations[index % s_pageSize];
+		}
+
+		bool isOutdated(uint32_t index) const {
+			return (getOutdatedWord(index).load(std::memory_order_relaxed) & getBit(index)) != 0;
+		}
+
+		// Transforms of different entities may be changed from different threads, sharing a word of bits
+		void markOutdated(uint32_t index) {
+			auto outdatedWord = getOutdatedWord(index);
+			auto bit = getBit(index);
+
+			if ((outdatedWord.load(std::memory_order_relaxed) & bit) == 0) {
+				outdatedWord.fetch_or(bit, std::memory_order_relaxed);
+			}
+		}
+
+		std::atomic_ref<uint64_t> getOutdatedWord(uint32_t index) const {
+			return std::atomic_ref(const_cast<uint64_t&>(m_outdatedBits[index / s_bitsPerWord]));
+		}
+
+		static constexpr uint64_t getBit(uint32_t index) {
+			return uint64_t(1) << (index % s_bitsPerWord);
+		}
+	};
+}
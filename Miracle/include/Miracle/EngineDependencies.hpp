@@ -13,9 +13,12 @@
 #include "Application/IMultimediaFramework.hpp"
 #include "Application/IWindow.hpp"
 #include "Application/IKeyboard.hpp"
+#include "Application/Graphics/IContextTarget.hpp"
 #include "Application/Graphics/IGraphicsApi.hpp"
 #include "Application/Graphics/IGraphicsContext.hpp"
 #include "Application/IEcs.hpp"
+#include "Application/JobSystem.hpp"
+#include "Application/FrameProfiler.hpp"
 #include "Application/Graphics/Renderer.hpp"
 #include "Application/SceneManager.hpp"
 #include "Application/TextInputService.hpp"
@@ -29,9 +32,12 @@ namespace Miracle {
 		std::unique_ptr<Application::IMultimediaFramework> m_multimediaFramework;
 		std::unique_ptr<Application::IWindow> m_window;
 		std::unique_ptr<Application::IKeyboard> m_keyboard;
+		std::unique_ptr<Application::IContextTarget> m_headlessTarget;
 		std::unique_ptr<Application::IGraphicsApi> m_graphicsApi;
 		std::unique_ptr<Application::IGraphicsContext> m_graphicsContext;
 		std::unique_ptr<Application::IEcs> m_ecs;
+		Application::FrameProfiler m_frameProfiler;
+		Application::JobSystem m_jobSystem;
 		Application::Renderer m_renderer;
 		Application::SceneManager m_sceneManager;
 		Application::TextInputService m_textInputService;
@@ -49,6 +55,10 @@ namespace Miracle {
 			Application::EventDispatcher& eventDispatcher
 		);
 
+		Application::IFileAccess& getFileAccess() {
+			return *m_fileAccess.get();
+		}
+
 		Application::IMultimediaFramework& getMultimediaFramework() {
 			return *m_multimediaFramework.get();
 		}
@@ -81,6 +91,14 @@ namespace Miracle {
 			return m_performanceCountingService;
 		}
 
+		Application::JobSystem& getJobSystem() {
+			return m_jobSystem;
+		}
+
+		Application::FrameProfiler& getFrameProfiler() {
+			return m_frameProfiler;
+		}
+
 		Random& getRandom() { return m_random; }
 	};
 }
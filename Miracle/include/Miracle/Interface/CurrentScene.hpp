@@ -2,12 +2,17 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <utility>
+#include <vector>
 
 #include <Miracle/App.hpp>
 #include <Miracle/Common/Math/ColorRgb.hpp>
 #include <Miracle/Common/Models/EntityConfig.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Models/SystemId.hpp>
+#include <Miracle/Common/Models/PrefabId.hpp>
+#include <Miracle/Common/Models/TransformConfig.hpp>
 #include <Miracle/Common/EntityContext.hpp>
 #include <Miracle/Common/Components/Transform.hpp>
 
@@ -56,7 +61,112 @@ namespace Miracle {
 				.createAndGetEntity(config);
 		}
 
-		static void setEntityCreatedCallback(std::function<void(EntityId)>&& entityCreatedCallback) {
+		// Creates the given number of entities alike, invoking the entity created callback once for all of them
+		static std::vector<EntityId> createEntities(const EntityConfig& prototype, size_t count) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.createEntities(prototype, count);
+		}
+
+		static std::vector<EntityId> createEntities(std::span<const EntityConfig> configs) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.createEntities(configs);
+		}
+
+		// The entities are destroyed together before the next update, invoking the entity destroyed callback once
+		static void scheduleEntitiesDestruction(std::span<const EntityId> entities) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.scheduleEntitiesDestruction(entities);
+		}
+
+		static PrefabId registerPrefab(const EntityConfig& config) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.registerPrefab(config);
+		}
+
+		static EntityContext instantiatePrefab(PrefabId prefabId) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.instantiatePrefab(prefabId);
+		}
+
+		// The instance is placed by the given transform instead of the one of the prefab
+		static EntityContext instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.instantiatePrefab(prefabId, transformConfig);
+		}
+
+		static std::vector<EntityId> instantiatePrefabs(PrefabId prefabId, size_t count) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.instantiatePrefabs(prefabId, count);
+		}
+
+		// The transform of the child becomes relative to the parent
+		static void setParent(EntityId child, EntityId parent) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.setParent(child, parent);
+		}
+
+		static void removeParent(EntityId child) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.removeParent(child);
+		}
+
+		// Calls the callable with the given components of every entity that has all of them
+		template<typename... Components, typename ForEach>
+		static void forEachEntity(ForEach&& forEach) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.forEachEntity<Components...>(std::forward<ForEach>(forEach));
+		}
+
+		// The system function is called with the given components of every entity that has all of them, each update.
+		// Components declared const are only read, which lets systems sharing them run concurrently
+		template<typename... Components, typename SystemFunction>
+		static SystemId addSystem(SystemFunction&& systemFunction) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.addSystem<Components...>(std::forward<SystemFunction>(systemFunction));
+		}
+
+		static void removeSystem(SystemId systemId) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getSceneManager()
+				.getCurrentScene()
+				.removeSystem(systemId);
+		}
+
+		static void setEntityCreatedCallback(std::function<void(std::span<const EntityId>)>&& entityCreatedCallback) {
 			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
 
 			App::s_currentApp->m_dependencies->getSceneManager()
@@ -72,7 +182,7 @@ namespace Miracle {
 				.unsetEntityCreatedCallback();
 		}
 
-		static void setEntityDestroyedCallback(std::function<void(EntityId)>&& entityDestroyedCallback) {
+		static void setEntityDestroyedCallback(std::function<void(std::span<const EntityId>)>&& entityDestroyedCallback) {
 			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
 
 			App::s_currentApp->m_dependencies->getSceneManager()
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <utility>
+
+#include <Miracle/App.hpp>
+#include <Miracle/Application/JobSystem.hpp>
+
+namespace Miracle {
+	using Job = Application::Job;
+	using ParallelForJob = Application::ParallelForJob;
+	using JobCounter = Application::JobCounter;
+
+	class Jobs {
+	public:
+		Jobs() = delete;
+
+		static size_t getWorkerThreadCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getJobSystem().getWorkerThreadCount();
+		}
+
+		static void schedule(Job&& job, JobCounter& counter) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getJobSystem().schedule(std::move(job), counter);
+		}
+
+		static void scheduleAfter(JobCounter& dependency, Job&& job, JobCounter& counter) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getJobSystem().scheduleAfter(dependency, std::move(job), counter);
+		}
+
+		// Main thread jobs run once per frame, or while the main thread waits on a counter
+		static void scheduleOnMainThread(Job&& job, JobCounter& counter) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getJobSystem().scheduleOnMainThread(std::move(job), counter);
+		}
+
+		static void wait(JobCounter& counter) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getJobSystem().wait(counter);
+		}
+
+		static void parallelFor(size_t count, const ParallelForJob& job) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getJobSystem().parallelFor(count, job);
+		}
+	};
+}
@@ -3,10 +3,15 @@
 #include <utility>
 
 #include <Miracle/App.hpp>
+#include <Miracle/Common/BehaviorPool.hpp>
+#include <Miracle/Common/Models/BehaviorAllocationCounters.hpp>
+#include <Miracle/Common/Models/FramePhase.hpp>
 #include <Miracle/Application/PerformanceCountingService.hpp>
+#include <Miracle/Application/FrameProfiler.hpp>
 
 namespace Miracle {
 	using CountersUpdatedCallback = Application::CountersUpdatedCallback;
+	using FramePhaseTimings = Application::FramePhaseTimings;
 
 	class PerformanceCounters {
 	public:
@@ -24,6 +29,52 @@ namespace Miracle {
 			return App::s_currentApp->m_dependencies->getPerformanceCountingService().getUps();
 		}
 
+		static size_t getDrawnEntityCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getPerformanceCountingService().getDrawnEntityCount();
+		}
+
+		static size_t getCulledEntityCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getPerformanceCountingService().getCulledEntityCount();
+		}
+
+		// Pipelines bound while recording the last frame, skipping those already bound
+		static size_t getPipelineBindCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getPerformanceCountingService().getPipelineBindCount();
+		}
+
+		// Vertex, index and instance buffers bound while recording the last frame, skipping those already bound
+		static size_t getBufferBindCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getPerformanceCountingService().getBufferBindCount();
+		}
+
+		// Minimum, average and 99th percentile durations of a frame phase over the most recent frames
+		static FramePhaseTimings getFramePhaseTimings(FramePhase phase) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getFrameProfiler().getPhaseTimings(phase);
+		}
+
+		static void resetFramePhaseTimings() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getFrameProfiler().reset();
+		}
+
+		// Allocation counts of behaviors created through BehaviorFactory::createFactoryFor since startup
+		static const BehaviorAllocationCounters& getBehaviorAllocationCounters() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return BehaviorPoolBase::getAllocationCounters();
+		}
+
 		static void setCountersUpdatedCallback(CountersUpdatedCallback&& countersUpdatedCallback) {
 			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
 
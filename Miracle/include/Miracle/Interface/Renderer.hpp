@@ -1,8 +1,13 @@
 #pragma once
 
 #include <Miracle/App.hpp>
+#include <Miracle/Application/Graphics/FrameAllocationStats.hpp>
+#include <Miracle/Application/Graphics/FrameImage.hpp>
 
 namespace Miracle {
+	using FrameAllocationStats = Application::FrameAllocationStats;
+	using FrameImage = Application::FrameImage;
+
 	class Renderer {
 	public:
 		Renderer() = delete;
@@ -37,5 +42,107 @@ namespace Miracle {
 			App::s_currentApp->m_dependencies->getRenderer()
 				.setVsyncAndTripleBuffering(useVsync, useTripleBuffering);
 		}
+
+		static RenderingMode getRenderingMode() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getRenderingMode();
+		}
+
+		static void setRenderingMode(RenderingMode renderingMode) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getRenderer().setRenderingMode(renderingMode);
+		}
+
+		static size_t getRecordingThreadCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getRecordingThreadCount();
+		}
+
+		static void setRecordingThreadCount(size_t recordingThreadCount) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getRenderer().setRecordingThreadCount(recordingThreadCount);
+		}
+
+		static bool isUsingDepthPrePass() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().isUsingDepthPrePass();
+		}
+
+		static void setDepthPrePass(bool useDepthPrePass) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getRenderer().setDepthPrePass(useDepthPrePass);
+		}
+
+		static FrameImage readLastFrame() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().readLastFrame();
+		}
+
+		static FrameAllocationStats getFrameAllocationStats() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getFrameAllocationStats();
+		}
+
+		static size_t addMesh(const Mesh& mesh) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().addMesh(mesh);
+		}
+
+		static void replaceMesh(size_t meshIndex, const Mesh& mesh) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getRenderer().replaceMesh(meshIndex, mesh);
+		}
+
+		static void removeMesh(size_t meshIndex) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			App::s_currentApp->m_dependencies->getRenderer().removeMesh(meshIndex);
+		}
+
+		static bool isMeshLoaded(size_t meshIndex) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().isMeshLoaded(meshIndex);
+		}
+
+		static size_t getMeshResidentBytes(size_t meshIndex) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getMeshResidentBytes(meshIndex);
+		}
+
+		static size_t getResidentMeshBytes() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getResidentMeshBytes();
+		}
+
+		static size_t getMaterialCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getMaterialCount();
+		}
+
+		static size_t addMaterial(const MaterialConfig& materialConfig) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().addMaterial(materialConfig);
+		}
+
+		static size_t getGraphicsPipelineCount() {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			return App::s_currentApp->m_dependencies->getRenderer().getGraphicsPipelineCount();
+		}
 	};
 }
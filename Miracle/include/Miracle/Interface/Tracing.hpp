@@ -0,0 +1,36 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <string>
+
+#include <Miracle/App.hpp>
+#include <Miracle/Application/Tracer.hpp>
+
+namespace Miracle {
+	class Tracing {
+	public:
+		Tracing() = delete;
+
+		// Whether trace zones are compiled in, which is controlled by the MIRACLE_ENABLE_TRACING option
+		static constexpr bool isEnabled() {
+#ifdef MIRACLE_ENABLE_TRACING
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		// Writes the most recent trace zones of all threads as a Chrome trace, viewable in Perfetto
+		static void writeChromeTrace(const std::filesystem::path& filePath) {
+			if (App::s_currentApp == nullptr) [[unlikely]] throw NoAppRunningError();
+
+			auto json = Application::Tracer::createChromeTraceJson();
+
+			App::s_currentApp->m_dependencies->getFileAccess().writeFileAsBinary(
+				filePath,
+				std::as_bytes(std::span(json))
+			);
+		}
+	};
+}
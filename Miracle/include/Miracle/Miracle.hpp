@@ -14,10 +14,13 @@
 #include "Interface/Clipboard.hpp"
 #include "Interface/DeltaTime.hpp"
 #include "Interface/PerformanceCounters.hpp"
+#include "Interface/Tracing.hpp"
+#include "Interface/Jobs.hpp"
 
 #include "Common/UnicodeConverter.hpp"
 #include "Common/Random.hpp"
 #include "Common/Components/Transform.hpp"
+#include "Common/Components/TransformParent.hpp"
 #include "Common/Components/Camera.hpp"
 #include "Common/Components/Appearance.hpp"
 #include "Common/Components/Behavior.hpp"
@@ -29,3 +32,4 @@
 #include "Common/Math/Matrix4.hpp"
 #include "Common/Math/Quaternion.hpp"
 #include "Common/Math/MathUtilities.hpp"
+#include "Common/Math/MathKernels.hpp"
@@ -81,6 +81,8 @@ namespace Miracle {
 		auto& sceneManager = m_dependencies->getSceneManager();
 		auto& deltaTimeService = m_dependencies->getDeltaTimeService();
 		auto& performanceCountingService = m_dependencies->getPerformanceCountingService();
+		auto& frameProfiler = m_dependencies->getFrameProfiler();
+		auto& jobSystem = m_dependencies->getJobSystem();
 
 		m_running = true;
 		deltaTimeService.updateDeltaTime();
@@ -89,8 +91,11 @@ namespace Miracle {
 			m_config.startScript();
 
 			while (m_running) {
+				frameProfiler.beginPhase(FramePhase::eventProcessing);
 				keyboard.setAllKeyStatesAsDated();
 				framework.processEvents();
+				jobSystem.runMainThreadJobs();
+				frameProfiler.endPhase(FramePhase::eventProcessing);
 
 				if (window.shouldClose()) {
 					m_running = false;
@@ -99,16 +104,34 @@ namespace Miracle {
 
 				deltaTimeService.updateDeltaTime();
 
+				frameProfiler.beginPhase(FramePhase::updateScript);
 				m_config.updateScript();
+				frameProfiler.endPhase(FramePhase::updateScript);
+
 				auto& currentScene = sceneManager.getCurrentScene();
+
+				frameProfiler.beginPhase(FramePhase::entityDestruction);
 				currentScene.destroyScheduledEntities();
+				frameProfiler.endPhase(FramePhase::entityDestruction);
+
+				frameProfiler.beginPhase(FramePhase::sceneUpdate);
 				currentScene.update();
+				frameProfiler.endPhase(FramePhase::sceneUpdate);
+
 				performanceCountingService.incrementUpdateCounter();
 
 				bool frameRendered = renderer.render(sceneManager.getCurrentScene());
 
 				if (frameRendered) {
 					performanceCountingService.incrementFrameCounter();
+					performanceCountingService.setFrameEntityCounts(
+						renderer.getDrawnEntityCount(),
+						renderer.getCulledEntityCount()
+					);
+					performanceCountingService.setFrameBindCounts(
+						renderer.getPipelineBindCount(),
+						renderer.getBufferBindCount()
+					);
 				}
 
 				performanceCountingService.updateCounters();
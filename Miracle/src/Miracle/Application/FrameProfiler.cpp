@@ -0,0 +1,54 @@
+#include <Miracle/Application/FrameProfiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Miracle::Application {
+	FrameProfiler::FrameProfiler() {
+		for (auto& phaseSamples : m_phaseSamplesList) {
+			phaseSamples.durations.reserve(s_sampleCapacity);
+		}
+	}
+
+	FramePhaseTimings FrameProfiler::getPhaseTimings(FramePhase phase) const {
+		auto& durations = m_phaseSamplesList[static_cast<size_t>(phase)].durations;
+
+		if (durations.empty()) return FramePhaseTimings{};
+
+		auto sortedDurations = durations;
+		std::sort(sortedDurations.begin(), sortedDurations.end());
+
+		auto percentile99Index = static_cast<size_t>(
+			std::ceil(0.99 * static_cast<double>(sortedDurations.size()))
+		) - 1;
+
+		auto durationSum = std::accumulate(sortedDurations.begin(), sortedDurations.end(), 0.0);
+
+		return FramePhaseTimings{
+			.minimum      = std::chrono::duration<double>(sortedDurations.front()),
+			.average      = std::chrono::duration<double>(durationSum / static_cast<double>(sortedDurations.size())),
+			.percentile99 = std::chrono::duration<double>(sortedDurations[percentile99Index]),
+			.sampleCount  = sortedDurations.size()
+		};
+	}
+
+	void FrameProfiler::reset() {
+		for (auto& phaseSamples : m_phaseSamplesList) {
+			phaseSamples.durations.clear();
+			phaseSamples.nextSampleIndex = 0;
+		}
+	}
+
+	void FrameProfiler::addSample(PhaseSamples& phaseSamples, double duration) {
+		// Once full, the oldest sample is overwritten
+		if (phaseSamples.durations.size() < s_sampleCapacity) {
+			phaseSamples.durations.push_back(duration);
+		}
+		else {
+			phaseSamples.durations[phaseSamples.nextSampleIndex] = duration;
+		}
+
+		phaseSamples.nextSampleIndex = (phaseSamples.nextSampleIndex + 1) % s_sampleCapacity;
+	}
+}
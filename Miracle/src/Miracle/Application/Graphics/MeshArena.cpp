@@ -0,0 +1,248 @@
+#include <Miracle/Application/Graphics/MeshArena.hpp>
+
+#include <algorithm>
+#include <format>
+
+namespace Miracle::Application {
+	MeshArena::MeshArena(
+		ILogger& logger,
+		IGraphicsApi& api,
+		IGraphicsContext& context,
+		const std::vector<Mesh>& meshes
+	) :
+		m_logger(logger),
+		m_api(api),
+		m_context(context)
+	{
+		uint32_t vertexCount = 0;
+		uint32_t faceCount = 0;
+
+		for (auto& mesh : meshes) {
+			validateMesh(mesh);
+
+			vertexCount += static_cast<uint32_t>(mesh.vertices.size());
+			faceCount += static_cast<uint32_t>(mesh.faces.size());
+		}
+
+		m_slots.reserve(meshes.size());
+
+		// Meshes given up front are sized to fit in the first page, so they can all be drawn with one binding
+		for (auto& mesh : meshes) {
+			auto allocation = allocate(mesh, vertexCount, faceCount);
+
+			upload(allocation, mesh);
+
+			m_slots.push_back(
+				Slot{
+					.loaded     = true,
+					.allocation = allocation,
+					.range      = createMeshRange(allocation, mesh)
+				}
+			);
+		}
+	}
+
+	size_t MeshArena::getMeshResidentBytes(size_t meshIndex) const {
+		if (!isMeshLoaded(meshIndex)) return 0;
+
+		auto& allocation = m_slots[meshIndex].allocation;
+
+		return allocation.vertexCount * sizeof(Vertex) + allocation.faceCount * sizeof(Face);
+	}
+
+	size_t MeshArena::getResidentBytes() const {
+		size_t residentBytes = 0;
+
+		for (auto& page : m_pages) {
+			residentBytes += page.vertexBuffer->getVertexCapacity() * sizeof(Vertex)
+				+ page.indexBuffer->getFaceCapacity() * sizeof(Face);
+		}
+
+		return residentBytes;
+	}
+
+	size_t MeshArena::addMesh(const Mesh& mesh) {
+		validateMesh(mesh);
+
+		auto allocation = allocate(mesh, 0, 0);
+
+		upload(allocation, mesh);
+
+		size_t meshIndex = m_slots.size();
+
+		if (!m_freeSlotIndices.empty()) {
+			meshIndex = m_freeSlotIndices.back();
+			m_freeSlotIndices.pop_back();
+		}
+		else {
+			m_slots.emplace_back();
+		}
+
+		m_slots[meshIndex] = Slot{
+			.loaded     = true,
+			.allocation = allocation,
+			.range      = createMeshRange(allocation, mesh)
+		};
+
+		m_logger.info(std::format("Mesh added at index {}", meshIndex));
+
+		return meshIndex;
+	}
+
+	void MeshArena::replaceMesh(size_t meshIndex, const Mesh& mesh) {
+		validateMeshLoaded(meshIndex);
+		validateMesh(mesh);
+
+		auto allocation = allocate(mesh, 0, 0);
+
+		upload(allocation, mesh);
+		release(m_slots[meshIndex].allocation);
+
+		m_slots[meshIndex] = Slot{
+			.loaded     = true,
+			.allocation = allocation,
+			.range      = createMeshRange(allocation, mesh)
+		};
+
+		m_logger.info(std::format("Mesh replaced at index {}", meshIndex));
+	}
+
+	void MeshArena::removeMesh(size_t meshIndex) {
+		validateMeshLoaded(meshIndex);
+
+		release(m_slots[meshIndex].allocation);
+
+		m_slots[meshIndex] = Slot{};
+		m_freeSlotIndices.push_back(meshIndex);
+
+		m_logger.info(std::format("Mesh removed at index {}", meshIndex));
+	}
+
+	void MeshArena::beginFrame() {
+		m_frameNumber++;
+
+		auto framesInFlight = static_cast<uint64_t>(m_context.getFramesInFlight());
+
+		std::erase_if(
+			m_pendingReleases,
+			[&](const PendingRelease& pendingRelease) {
+				if (pendingRelease.frameNumber + framesInFlight > m_frameNumber) return false;
+
+				auto& allocation = pendingRelease.allocation;
+				auto& page = m_pages[allocation.pageIndex];
+
+				page.vertexAllocator.free(allocation.firstVertex, allocation.vertexCount);
+				page.faceAllocator.free(allocation.firstFace, allocation.faceCount);
+
+				return true;
+			}
+		);
+	}
+
+	void MeshArena::bindPage(size_t pageIndex) {
+		m_pages[pageIndex].vertexBuffer->bind();
+		m_pages[pageIndex].indexBuffer->bind();
+	}
+
+	MeshArena::Allocation MeshArena::allocate(
+		const Mesh& mesh,
+		uint32_t minVertexCapacity,
+		uint32_t minFaceCapacity
+	) {
+		auto vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+		auto faceCount = static_cast<uint32_t>(mesh.faces.size());
+
+		for (size_t i = 0; i < m_pages.size(); i++) {
+			auto& page = m_pages[i];
+
+			auto firstVertex = page.vertexAllocator.allocate(vertexCount);
+
+			if (!firstVertex.has_value()) continue;
+
+			auto firstFace = page.faceAllocator.allocate(faceCount);
+
+			if (!firstFace.has_value()) {
+				page.vertexAllocator.free(firstVertex.value(), vertexCount);
+				continue;
+			}
+
+			return Allocation{
+				.pageIndex   = i,
+				.firstVertex = firstVertex.value(),
+				.vertexCount = vertexCount,
+				.firstFace   = firstFace.value(),
+				.faceCount   = faceCount
+			};
+		}
+
+		auto vertexCapacity = std::max({ s_pageVertexCapacity, minVertexCapacity, vertexCount });
+		auto faceCapacity = std::max({ s_pageFaceCapacity, minFaceCapacity, faceCount });
+
+		auto& page = m_pages.emplace_back(
+			Page{
+				.vertexBuffer    = m_api.createVertexBuffer(m_context, vertexCapacity),
+				.indexBuffer     = m_api.createIndexBuffer(m_context, faceCapacity),
+				.vertexAllocator = RangeAllocator(vertexCapacity),
+				.faceAllocator   = RangeAllocator(faceCapacity)
+			}
+		);
+
+		m_logger.info(
+			std::format(
+				"Mesh arena page created with capacity for {} vertices and {} faces",
+				vertexCapacity,
+				faceCapacity
+			)
+		);
+
+		return Allocation{
+			.pageIndex   = m_pages.size() - 1,
+			.firstVertex = page.vertexAllocator.allocate(vertexCount).value(),
+			.vertexCount = vertexCount,
+			.firstFace   = page.faceAllocator.allocate(faceCount).value(),
+			.faceCount   = faceCount
+		};
+	}
+
+	void MeshArena::upload(const Allocation& allocation, const Mesh& mesh) {
+		auto& page = m_pages[allocation.pageIndex];
+
+		page.vertexBuffer->write(allocation.firstVertex, mesh.vertices);
+		page.indexBuffer->write(allocation.firstFace, mesh.faces);
+	}
+
+	void MeshArena::release(const Allocation& allocation) {
+		m_pendingReleases.push_back(
+			PendingRelease{
+				.allocation  = allocation,
+				.frameNumber = m_frameNumber
+			}
+		);
+	}
+
+	MeshRange MeshArena::createMeshRange(const Allocation& allocation, const Mesh& mesh) const {
+		auto indicesPerFace = static_cast<uint32_t>(Face{}.indices.size());
+
+		return MeshRange{
+			.pageIndex    = allocation.pageIndex,
+			.firstIndex   = allocation.firstFace * indicesPerFace,
+			.indexCount   = allocation.faceCount * indicesPerFace,
+			.vertexOffset = static_cast<int32_t>(allocation.firstVertex),
+			.bounds       = BoundingSphere::createFromVertices(mesh.vertices)
+		};
+	}
+
+	void MeshArena::validateMesh(const Mesh& mesh) const {
+		if (mesh.vertices.empty() || mesh.faces.empty()) {
+			m_logger.error("Mesh without vertices or faces provided to mesh arena");
+			throw MeshArenaErrors::EmptyMeshError();
+		}
+	}
+
+	void MeshArena::validateMeshLoaded(size_t meshIndex) const {
+		if (!isMeshLoaded(meshIndex)) {
+			m_logger.error(std::format("No mesh loaded at index {}", meshIndex));
+			throw MeshArenaErrors::MeshNotLoadedError();
+		}
+	}
+}
@@ -0,0 +1,136 @@
+#include <Miracle/Application/Graphics/PipelineLibrary.hpp>
+
+#include <format>
+#include <functional>
+
+namespace Miracle::Application {
+	PipelineLibrary::PipelineLibrary(
+		ILogger& logger,
+		IFileAccess& fileAccess,
+		IGraphicsApi& api,
+		IGraphicsContext& context,
+		ISwapchain& swapchain,
+		JobSystem& jobSystem
+	) :
+		m_logger(logger),
+		m_fileAccess(fileAccess),
+		m_api(api),
+		m_context(context),
+		m_swapchain(swapchain),
+		m_jobSystem(jobSystem)
+	{}
+
+	PipelineLibrary::~PipelineLibrary() {
+		m_jobSystem.wait(m_creationCounter);
+	}
+
+	size_t PipelineLibrary::request(const GraphicsPipelineInitProps& initProps) {
+		bool isAdded = false;
+		auto pipelineIndex = findOrAddEntry(initProps, isAdded);
+
+		if (!isAdded) return pipelineIndex;
+
+		auto& entry = *m_entries[pipelineIndex];
+
+		// Background jobs only run on worker threads
+		if (m_jobSystem.getWorkerThreadCount() == 0) {
+			createPipeline(entry, pipelineIndex);
+			return pipelineIndex;
+		}
+
+		// Kept off the regular queues, so that the frame's own waits never pick up a compilation
+		m_jobSystem.scheduleInBackground(
+			[this, &entry, pipelineIndex]() { createPipeline(entry, pipelineIndex); },
+			m_creationCounter
+		);
+
+		m_logger.info(std::format("Graphics pipeline {} scheduled for creation", pipelineIndex));
+
+		return pipelineIndex;
+	}
+
+	size_t PipelineLibrary::require(const GraphicsPipelineInitProps& initProps) {
+		bool isAdded = false;
+		auto pipelineIndex = findOrAddEntry(initProps, isAdded);
+
+		auto& entry = *m_entries[pipelineIndex];
+
+		if (isAdded) {
+			createPipeline(entry, pipelineIndex);
+		}
+		else if (entry.state.load(std::memory_order_acquire) == PipelineState::pending) {
+			m_jobSystem.wait(m_creationCounter);
+		}
+
+		if (entry.state.load(std::memory_order_acquire) == PipelineState::failed) {
+			std::rethrow_exception(entry.exception);
+		}
+
+		return pipelineIndex;
+	}
+
+	IGraphicsPipeline* PipelineLibrary::getPipeline(size_t pipelineIndex) const {
+		auto& entry = *m_entries[pipelineIndex];
+
+		if (entry.state.load(std::memory_order_acquire) != PipelineState::ready) [[unlikely]] return nullptr;
+
+		return entry.pipeline.get();
+	}
+
+	size_t PipelineLibrary::findOrAddEntry(const GraphicsPipelineInitProps& initProps, bool& isAdded) {
+		auto hash = createHash(initProps);
+		auto [first, last] = m_entryIndicesByHash.equal_range(hash);
+
+		for (auto it = first; it != last; it++) {
+			if (m_entries[it->second]->initProps == initProps) {
+				isAdded = false;
+				return it->second;
+			}
+		}
+
+		auto pipelineIndex = m_entries.size();
+
+		auto& entry = m_entries.emplace_back(std::make_unique<Entry>());
+		entry->initProps = initProps;
+
+		m_entryIndicesByHash.emplace(hash, pipelineIndex);
+
+		isAdded = true;
+
+		return pipelineIndex;
+	}
+
+	void PipelineLibrary::createPipeline(Entry& entry, size_t pipelineIndex) {
+		try {
+			entry.pipeline = m_api.createGraphicsPipeline(m_fileAccess, m_context, m_swapchain, entry.initProps);
+			entry.state.store(PipelineState::ready, std::memory_order_release);
+		}
+		catch (...) {
+			m_logger.error(std::format("Failed to create graphics pipeline {}, it will not be used", pipelineIndex));
+
+			entry.exception = std::current_exception();
+			entry.state.store(PipelineState::failed, std::memory_order_release);
+		}
+	}
+
+	size_t PipelineLibrary::createHash(const GraphicsPipelineInitProps& initProps) {
+		size_t hash = 0;
+
+		auto combine = [&](size_t valueHash) {
+			hash ^= valueHash + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2);
+		};
+
+		combine(std::filesystem::hash_value(initProps.vertexShaderPath));
+		combine(std::filesystem::hash_value(initProps.fragmentShaderPath));
+		combine(std::hash<bool>()(initProps.useInstanceData));
+		combine(std::hash<GraphicsPipelineDepthMode>()(initProps.depthMode));
+		combine(std::hash<CullMode>()(initProps.cullMode));
+		combine(std::hash<BlendMode>()(initProps.blendMode));
+
+		for (auto specializationConstant : initProps.specializationConstants) {
+			combine(std::hash<uint32_t>()(specializationConstant));
+		}
+
+		return hash;
+	}
+}
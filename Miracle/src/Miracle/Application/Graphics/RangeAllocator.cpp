@@ -0,0 +1,56 @@
+#include <Miracle/Application/Graphics/RangeAllocator.hpp>
+
+#include <algorithm>
+
+namespace Miracle::Application {
+	RangeAllocator::RangeAllocator(uint32_t capacity) :
+		m_capacity(capacity),
+		m_freeRanges({ FreeRange{ .offset = 0, .size = capacity } })
+	{}
+
+	std::optional<uint32_t> RangeAllocator::allocate(uint32_t size) {
+		for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); it++) {
+			if (it->size < size) continue;
+
+			auto offset = it->offset;
+
+			it->offset += size;
+			it->size -= size;
+
+			if (it->size == 0) {
+				m_freeRanges.erase(it);
+			}
+
+			return offset;
+		}
+
+		return std::nullopt;
+	}
+
+	void RangeAllocator::free(uint32_t offset, uint32_t size) {
+		auto next = std::lower_bound(
+			m_freeRanges.begin(),
+			m_freeRanges.end(),
+			offset,
+			[](const FreeRange& range, uint32_t offset) { return range.offset < offset; }
+		);
+
+		auto range = m_freeRanges.insert(next, FreeRange{ .offset = offset, .size = size });
+
+		if (auto following = range + 1; following != m_freeRanges.end()
+			&& range->offset + range->size == following->offset
+		) {
+			range->size += following->size;
+			range = m_freeRanges.erase(following) - 1;
+		}
+
+		if (range != m_freeRanges.begin()) {
+			auto preceding = range - 1;
+
+			if (preceding->offset + preceding->size == range->offset) {
+				preceding->size += range->size;
+				m_freeRanges.erase(range);
+			}
+		}
+	}
+}
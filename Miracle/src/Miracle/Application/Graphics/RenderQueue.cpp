@@ -0,0 +1,82 @@
+#include <Miracle/Application/Graphics/RenderQueue.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace Miracle::Application {
+	RenderQueue::RenderQueue() :
+		m_radixCounts(s_passCount * s_radixCount)
+	{}
+
+	uint64_t RenderQueue::createOpaqueSortKey(size_t pipelineIndex, size_t pageIndex, size_t meshIndex, float depth) {
+		return createStateBits(pipelineIndex, pageIndex, meshIndex) << s_depthBitCount
+			| static_cast<uint64_t>(createDepthBits(depth));
+	}
+
+	uint64_t RenderQueue::createBlendedSortKey(size_t pipelineIndex, size_t pageIndex, size_t meshIndex, float depth) {
+		auto stateBitCount = s_pipelineBitCount + s_pageBitCount + s_meshBitCount;
+
+		// Blending needs what is behind to be drawn first, so depth decides the order before state does
+		return uint64_t(1) << (64 - s_blendedBitCount)
+			| static_cast<uint64_t>(~createDepthBits(depth)) << stateBitCount
+			| createStateBits(pipelineIndex, pageIndex, meshIndex);
+	}
+
+	void RenderQueue::sort() {
+		if (m_entries.size() < 2) return;
+
+		std::fill(m_radixCounts.begin(), m_radixCounts.end(), 0);
+
+		// The counts of all passes are gathered in a single read of the keys
+		for (auto& entry : m_entries) {
+			for (uint32_t pass = 0; pass < s_passCount; pass++) {
+				auto radix = (entry.sortKey >> (pass * s_radixBitCount)) & (s_radixCount - 1);
+				m_radixCounts[pass * s_radixCount + radix]++;
+			}
+		}
+
+		m_sortBuffer.resize(m_entries.size());
+
+		for (uint32_t pass = 0; pass < s_passCount; pass++) {
+			auto radixCounts = std::span(m_radixCounts).subspan(pass * s_radixCount, s_radixCount);
+			auto shift = pass * s_radixBitCount;
+
+			// Passes over bytes that all keys share would not move anything
+			auto firstRadix = (m_entries.front().sortKey >> shift) & (s_radixCount - 1);
+
+			if (radixCounts[firstRadix] == m_entries.size()) continue;
+
+			uint32_t offset = 0;
+
+			for (auto& radixCount : radixCounts) {
+				auto count = radixCount;
+				radixCount = offset;
+				offset += count;
+			}
+
+			for (auto& entry : m_entries) {
+				auto radix = (entry.sortKey >> shift) & (s_radixCount - 1);
+				m_sortBuffer[radixCounts[radix]++] = entry;
+			}
+
+			m_entries.swap(m_sortBuffer);
+		}
+	}
+
+	uint64_t RenderQueue::createStateBits(size_t pipelineIndex, size_t pageIndex, size_t meshIndex) {
+		auto pipelineBits = static_cast<uint64_t>(pipelineIndex) & ((uint64_t(1) << s_pipelineBitCount) - 1);
+		auto pageBits = static_cast<uint64_t>(pageIndex) & ((uint64_t(1) << s_pageBitCount) - 1);
+		auto meshBits = static_cast<uint64_t>(meshIndex) & ((uint64_t(1) << s_meshBitCount) - 1);
+
+		return pipelineBits << (s_pageBitCount + s_meshBitCount)
+			| pageBits << s_meshBitCount
+			| meshBits;
+	}
+
+	uint32_t RenderQueue::createDepthBits(float depth) {
+		// Flipping the sign bit of positive floats and all bits of negative ones makes their bits order like their values
+		auto depthBits = std::bit_cast<uint32_t>(depth);
+
+		return (depthBits & 0x80000000) != 0 ? ~depthBits : depthBits | 0x80000000;
+	}
+}
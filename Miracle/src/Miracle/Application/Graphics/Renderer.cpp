@@ -1,6 +1,11 @@
 #include <Miracle/Application/Graphics/Renderer.hpp>
 
+#include <algorithm>
+#include <format>
+
 #include <Miracle/Common/Components/Camera.hpp>
+#include <Miracle/Common/Math/MathKernels.hpp>
+#include <Miracle/Application/Tracer.hpp>
 
 namespace Miracle::Application {
 	Renderer::Renderer(
@@ -8,16 +13,62 @@ namespace Miracle::Application {
 		IFileAccess& fileAccess,
 		IGraphicsApi& api,
 		IGraphicsContext& context,
+		FrameProfiler& frameProfiler,
+		JobSystem& jobSystem,
 		const RendererInitProps& initProps
 	) :
 		m_logger(logger),
 		m_fileAccess(fileAccess),
 		m_api(api),
 		m_context(context),
+		m_frameProfiler(frameProfiler),
+		m_jobSystem(jobSystem),
 		m_swapchain(m_api.createSwapchain(m_context, initProps.swapchainInitProps)),
-		m_pipeline(m_api.createGraphicsPipeline(m_fileAccess, m_context, *m_swapchain.get())),
-		m_meshBuffersList(createMeshBuffersList(initProps.meshes))
+		m_pipelineLibrary(m_logger, m_fileAccess, m_api, m_context, *m_swapchain.get(), m_jobSystem),
+		m_defaultPipelineIndex(
+			m_pipelineLibrary.require(createPipelineInitProps(MaterialConfig{}, GraphicsPipelineDepthMode::readWrite))
+		),
+		m_instancedPipeline(
+			m_api.createGraphicsPipeline(
+				m_fileAccess,
+				m_context,
+				*m_swapchain.get(),
+				GraphicsPipelineInitProps{
+					.vertexShaderPath   = "Assets/Shaders/Instanced.vert.spv",
+					.fragmentShaderPath = "Assets/Shaders/Instanced.frag.spv",
+					.useInstanceData    = true
+				}
+			)
+		),
+		m_cullingPipeline(
+			m_api.createCullingPipeline(
+				m_fileAccess,
+				m_context,
+				CullingPipelineInitProps{
+					.computeShaderPath = "Assets/Shaders/Culling.comp.spv"
+				}
+			)
+		),
+		m_instanceBuffer(m_api.createInstanceBuffer(m_context)),
+		m_meshArena(m_logger, m_api, m_context, initProps.meshes),
+		m_meshInstancesList(initProps.meshes.size()),
+		m_renderingMode(initProps.renderingMode),
+		m_useDepthPrePass(initProps.useDepthPrePass)
 	{
+		setRecordingThreadCount(initProps.recordingThreadCount);
+
+		for (auto& materialConfig : initProps.materials) {
+			m_materials.push_back(Material{ .config = materialConfig });
+		}
+
+		if (m_materials.empty()) {
+			m_materials.push_back(Material{});
+		}
+
+		if (!initProps.materials.empty() && m_renderingMode != RenderingMode::direct) {
+			m_logger.warning("Materials only apply to direct rendering, so they are ignored in the current rendering mode");
+		}
+
 		m_logger.info("Renderer created");
 	}
 
@@ -28,8 +79,12 @@ namespace Miracle::Application {
 	}
 
 	bool Renderer::render(const Scene& scene) {
+		MIRACLE_TRACE_ZONE("Renderer::render");
+
 		if (!m_context.getTarget().isCurrentlyPresentable()) [[unlikely]] return false;
 
+		m_meshArena.beginFrame();
+
 		if (m_context.getTarget().isSizeChanged()) [[unlikely]] {
 			m_context.waitForDeviceIdle();
 			m_swapchain->recreate();
@@ -77,62 +132,521 @@ namespace Miracle::Application {
 
 		auto viewProjection = view * projection;
 
+		m_drawnEntityCount = 0;
+		m_culledEntityCount = 0;
+		m_pipelineBindCount = 0;
+		m_bufferBindCount = 0;
+
 		m_context.recordGraphicsCommands(
 			[&]() {
-				m_swapchain->beginRenderPass(scene.getBackgroundColor());
-				m_context.setViewport(0.0f, 0.0f, swapchainImageSize.width, swapchainImageSize.height);
-				m_context.setScissor(0, 0, swapchainImageSize.width, swapchainImageSize.height);
-
-				if (!m_meshBuffersList.empty()) {
-					scene.forEachEntityAppearance(
-						[&](const Transform& transform, const Appearance& appearance) {
-							if (!appearance.isVisible()) [[unlikely]] return;
-
-							m_pipeline->bind();
-							m_pipeline->pushConstants(
-								PushConstants{
-									.vertexStageConstants = VertexStagePushConstants{
-										.transform = (transform.getTransformation() * viewProjection)
-											.toTransposed()
-									},
-									.fragmentStageConstants = FragmentStagePushConstants{
-										.color = appearance.getColor()
-									}
-								}
-							);
-
-							auto& meshBuffers = m_meshBuffersList[appearance.getMeshIndex()];
-
-							meshBuffers.vertexBuffer->bind();
-							meshBuffers.indexBuffer->bind();
-
-							m_context.drawIndexed(meshBuffers.indexBuffer->getIndexCount());
-						}
-					);
+				m_frameProfiler.beginPhase(FramePhase::renderRecording);
+
+				bool useSecondaryCommands = m_renderingMode == RenderingMode::direct
+					&& m_recordingThreadCount > 1;
+
+				// Culling is dispatched before the render pass, which cannot contain compute work
+				if (m_renderingMode == RenderingMode::gpuDriven) {
+					recordCullingCommands(scene, viewProjection);
+				}
+
+				m_context.beginGpuTiming();
+				m_swapchain->beginRenderPass(scene.getBackgroundColor(), useSecondaryCommands);
+
+				if (useSecondaryCommands) {
+					recordParallelDirectDrawCommands(scene, viewProjection, swapchainImageSize);
+				}
+				else {
+					m_context.setViewport(0.0f, 0.0f, swapchainImageSize.width, swapchainImageSize.height);
+					m_context.setScissor(0, 0, swapchainImageSize.width, swapchainImageSize.height);
+
+					auto bindState = BindState{};
+
+					switch (m_renderingMode) {
+					case RenderingMode::direct:
+						gatherDirectDraws(scene, viewProjection);
+						recordDepthPrePassCommands(bindState, m_renderQueue.getEntries());
+						recordDirectDrawCommands(bindState, m_renderQueue.getEntries());
+						break;
+
+					case RenderingMode::instanced:
+						recordInstancedDrawCommands(bindState, scene, viewProjection);
+						break;
+
+					case RenderingMode::gpuDriven:
+						recordGpuDrivenDrawCommands(bindState, viewProjection);
+						break;
+					}
+
+					addBindCounts(bindState);
 				}
 
 				m_swapchain->endRenderPass();
+				m_context.endGpuTiming();
+
+				m_frameProfiler.endPhase(FramePhase::renderRecording);
 			}
 		);
 
+		m_frameProfiler.beginPhase(FramePhase::renderSubmission);
 		m_context.submitGraphicsRecording();
+		m_frameProfiler.endPhase(FramePhase::renderSubmission);
 
+		m_frameProfiler.beginPhase(FramePhase::presentation);
 		m_swapchain->swap();
+		m_frameProfiler.endPhase(FramePhase::presentation);
+
+		// Timings become available once the frame slot is reused, so they lag a couple of frames behind
+		auto gpuTimingDuration = m_context.getLastGpuTimingDuration();
+
+		if (gpuTimingDuration.has_value()) {
+			m_frameProfiler.addPhaseDuration(FramePhase::gpuRenderPass, gpuTimingDuration.value());
+		}
+
+		return true;
+	}
+
+	void Renderer::setRecordingThreadCount(size_t recordingThreadCount) {
+		m_recordingThreadCount = std::max<size_t>(recordingThreadCount, 1);
+
+		m_logger.info(std::format("Renderer recording thread count set to {}", m_recordingThreadCount));
+	}
+
+	size_t Renderer::addMaterial(const MaterialConfig& materialConfig) {
+		m_materials.push_back(Material{ .config = materialConfig });
+
+		m_logger.info(std::format("Material added at index {}", m_materials.size() - 1));
+
+		return m_materials.size() - 1;
+	}
+
+	void Renderer::bindPipeline(BindState& bindState, IGraphicsPipeline& pipeline) {
+		if (bindState.pipeline == &pipeline) return;
+
+		pipeline.bind();
+
+		bindState.pipeline = &pipeline;
+		bindState.pipelineBindCount++;
+	}
+
+	void Renderer::bindMeshPage(BindState& bindState, size_t pageIndex) {
+		if (bindState.pageIndex == pageIndex) return;
+
+		m_meshArena.bindPage(pageIndex);
+
+		// A page is a vertex buffer and an index buffer
+		bindState.pageIndex = pageIndex;
+		bindState.bufferBindCount += 2;
+	}
+
+	void Renderer::addBindCounts(const BindState& bindState) {
+		m_pipelineBindCount += bindState.pipelineBindCount;
+		m_bufferBindCount += bindState.bufferBindCount;
+	}
+
+	bool Renderer::isEntityDrawn(
+		const Frustum& frustum,
+		const Transform& transform,
+		const Appearance& appearance
+	) {
+		if (!appearance.isVisible()) [[unlikely]] return false;
+		if (!m_meshArena.isMeshLoaded(appearance.getMeshIndex())) [[unlikely]] return false;
+
+		auto& meshRange = m_meshArena.getMeshRange(appearance.getMeshIndex());
+
+		if (!frustum.intersects(meshRange.bounds.toTransformed(transform.getWorldTransformation()))) {
+			m_culledEntityCount++;
+			return false;
+		}
+
+		m_drawnEntityCount++;
 
 		return true;
 	}
 
-	std::vector<MeshBuffers> Renderer::createMeshBuffersList(const std::vector<Mesh>& meshes) const {
-		auto list = std::vector<MeshBuffers>();
-		list.reserve(meshes.size());
+	GraphicsPipelineInitProps Renderer::createPipelineInitProps(
+		const MaterialConfig& materialConfig,
+		GraphicsPipelineDepthMode depthMode
+	) {
+		bool isPrePass = depthMode == GraphicsPipelineDepthMode::prePass;
+
+		// Pre-pass pipelines only keep the state that affects depth, so materials differing in shading share them
+		return GraphicsPipelineInitProps{
+			.vertexShaderPath        = materialConfig.vertexShaderPath,
+			.fragmentShaderPath      = isPrePass ? std::filesystem::path() : materialConfig.fragmentShaderPath,
+			.useInstanceData         = false,
+			.depthMode               = depthMode,
+			.cullMode                = materialConfig.cullMode,
+			.blendMode               = isPrePass ? BlendMode::opaque : materialConfig.blendMode,
+			.specializationConstants = materialConfig.specializationConstants
+		};
+	}
+
+	IGraphicsPipeline* Renderer::getMaterialPipeline(
+		std::optional<size_t>& pipelineIndex,
+		const MaterialConfig& materialConfig,
+		GraphicsPipelineDepthMode depthMode
+	) {
+		if (!pipelineIndex.has_value()) {
+			pipelineIndex = m_pipelineLibrary.request(createPipelineInitProps(materialConfig, depthMode));
+
+			if (pipelineIndex.value() >= RenderQueue::getMaxPipelineCount()) [[unlikely]] {
+				m_logger.warning(
+					std::format(
+						"Graphics pipeline {} exceeds the {} pipelines draws are grouped by, so its draws will bind more state",
+						pipelineIndex.value(),
+						RenderQueue::getMaxPipelineCount()
+					)
+				);
+			}
+		}
+
+		return m_pipelineLibrary.getPipeline(pipelineIndex.value());
+	}
+
+	const Renderer::MaterialDrawState& Renderer::resolveMaterialDrawState(size_t materialIndex) {
+		auto& drawState = m_materialDrawStates[materialIndex];
+
+		if (drawState.isResolved) [[likely]] return drawState;
+
+		auto& material = m_materials[materialIndex];
+		auto& config = material.config;
+
+		auto depthMode = !config.depthTest
+			? GraphicsPipelineDepthMode::disabled
+			: config.depthWrite
+				? GraphicsPipelineDepthMode::readWrite
+				: GraphicsPipelineDepthMode::readOnly;
+
+		drawState = MaterialDrawState{
+			.isResolved           = true,
+			.isBlended            = config.blendMode != BlendMode::opaque,
+			.pipelineIndex        = m_defaultPipelineIndex,
+			.pipeline             = m_pipelineLibrary.getPipeline(m_defaultPipelineIndex),
+			.depthPrePassPipeline = nullptr
+		};
+
+		if (auto pipeline = getMaterialPipeline(material.pipelineIndex, config, depthMode)) {
+			drawState.pipelineIndex = material.pipelineIndex.value();
+			drawState.pipeline = pipeline;
+		}
+
+		// Until both pre-pass pipelines exist, the material is drawn in a single pass
+		bool usesDepthPrePass = m_useDepthPrePass
+			&& !drawState.isBlended
+			&& depthMode == GraphicsPipelineDepthMode::readWrite;
+
+		if (!usesDepthPrePass) return drawState;
+
+		auto depthPrePassPipeline = getMaterialPipeline(
+			material.depthPrePassPipelineIndex,
+			config,
+			GraphicsPipelineDepthMode::prePass
+		);
+
+		auto depthReadOnlyPipeline = getMaterialPipeline(
+			material.depthReadOnlyPipelineIndex,
+			config,
+			GraphicsPipelineDepthMode::readOnly
+		);
+
+		if (depthPrePassPipeline != nullptr && depthReadOnlyPipeline != nullptr) {
+			drawState.pipelineIndex = material.depthReadOnlyPipelineIndex.value();
+			drawState.pipeline = depthReadOnlyPipeline;
+			drawState.depthPrePassPipeline = depthPrePassPipeline;
+		}
+
+		return drawState;
+	}
+
+	void Renderer::gatherDirectDraws(const Scene& scene, const Matrix4& viewProjection) {
+		m_directDraws.clear();
+		m_renderQueue.clear();
+		m_materialDrawStates.assign(m_materials.size(), MaterialDrawState{});
+
+		auto frustum = Frustum::createFromViewProjection(viewProjection);
+
+		m_directDrawTransforms.clear();
+		m_directDrawMaterialIndices.clear();
+
+		scene.forEachEntityAppearance(
+			[&](const Transform& transform, const Appearance& appearance) {
+				if (!isEntityDrawn(frustum, transform, appearance)) return;
+
+				// Draws with a material that does not exist fall back to the default one
+				auto materialIndex = appearance.getMaterialIndex() < m_materials.size()
+					? appearance.getMaterialIndex()
+					: 0;
+
+				auto& drawState = resolveMaterialDrawState(materialIndex);
+
+				m_directDrawTransforms.push_back(transform.getWorldTransformation());
+				m_directDrawMaterialIndices.push_back(materialIndex);
+
+				m_directDraws.push_back(
+					DirectDraw{
+						.pushConstants        = PushConstants{
+							.fragmentStageConstants = FragmentStagePushConstants{
+								.color = appearance.getColor()
+							}
+						},
+						.meshIndex            = appearance.getMeshIndex(),
+						.pipeline             = drawState.pipeline,
+						.depthPrePassPipeline = drawState.depthPrePassPipeline
+					}
+				);
+			}
+		);
+
+		// The view projection is applied to all drawn transforms as one batch
+		MathKernels::multiply(m_directDrawTransforms, viewProjection, m_directDrawTransforms);
+
+		for (size_t i = 0; i < m_directDraws.size(); i++) {
+			auto& directDraw = m_directDraws[i];
+
+			directDraw.pushConstants.vertexStageConstants.transform = m_directDrawTransforms[i].toTransposed();
+
+			auto& drawState = m_materialDrawStates[m_directDrawMaterialIndices[i]];
+			auto pageIndex = m_meshArena.getMeshRange(directDraw.meshIndex).pageIndex;
+
+			// Clip space depth of the entity origin grows with view depth for both projections
+			auto depth = m_directDrawTransforms[i].m43;
+
+			m_renderQueue.push(
+				drawState.isBlended
+					? RenderQueue::createBlendedSortKey(drawState.pipelineIndex, pageIndex, directDraw.meshIndex, depth)
+					: RenderQueue::createOpaqueSortKey(drawState.pipelineIndex, pageIndex, directDraw.meshIndex, depth),
+				static_cast<uint32_t>(i)
+			);
+		}
+
+		// Opaque draws sharing state end up together, front to back so early depth testing rejects hidden fragments
+		m_renderQueue.sort();
+	}
+
+	void Renderer::recordDepthPrePassCommands(BindState& bindState, std::span<const RenderQueueEntry> entries) {
+		if (!m_useDepthPrePass) return;
+
+		for (auto& entry : entries) {
+			auto& directDraw = m_directDraws[entry.drawIndex];
+
+			if (directDraw.depthPrePassPipeline == nullptr) continue;
+
+			recordDirectDraw(bindState, *directDraw.depthPrePassPipeline, directDraw);
+		}
+	}
+
+	void Renderer::recordDirectDrawCommands(BindState& bindState, std::span<const RenderQueueEntry> entries) {
+		for (auto& entry : entries) {
+			auto& directDraw = m_directDraws[entry.drawIndex];
+
+			recordDirectDraw(bindState, *directDraw.pipeline, directDraw);
+		}
+	}
+
+	void Renderer::recordDirectDraw(BindState& bindState, IGraphicsPipeline& pipeline, const DirectDraw& directDraw) {
+		bindPipeline(bindState, pipeline);
+
+		pipeline.pushConstants(directDraw.pushConstants);
+
+		auto& meshRange = m_meshArena.getMeshRange(directDraw.meshIndex);
+
+		bindMeshPage(bindState, meshRange.pageIndex);
+
+		m_context.drawIndexed(meshRange.indexCount, meshRange.firstIndex, meshRange.vertexOffset);
+	}
+
+	void Renderer::recordParallelDirectDrawCommands(
+		const Scene& scene,
+		const Matrix4& viewProjection,
+		const SwapchainImageSize& swapchainImageSize
+	) {
+		gatherDirectDraws(scene, viewProjection);
+
+		auto entries = m_renderQueue.getEntries();
+		auto chunkCount = m_recordingThreadCount;
+		auto drawsPerChunk = (entries.size() + chunkCount - 1) / chunkCount;
+
+		// The pre-pass of every chunk gets its own recorders, executed before any chunk is shaded,
+		// so that shading is tested against the depth of all draws rather than only those of its own chunk
+		auto recorderCount = m_useDepthPrePass ? chunkCount * 2 : chunkCount;
+
+		m_context.reserveSecondaryGraphicsRecorders(recorderCount);
+		m_recorderBindStates.assign(recorderCount, BindState{});
+
+		m_jobSystem.parallelFor(
+			recorderCount,
+			[&](size_t recorderIndex) {
+				bool isDepthPrePass = m_useDepthPrePass && recorderIndex < chunkCount;
+				auto chunkIndex = recorderIndex % chunkCount;
+				auto firstDraw = std::min(chunkIndex * drawsPerChunk, entries.size());
+				auto drawCount = std::min(drawsPerChunk, entries.size() - firstDraw);
+
+				m_context.recordSecondaryGraphicsCommands(
+					recorderIndex,
+					[&]() {
+						m_context.setViewport(0.0f, 0.0f, swapchainImageSize.width, swapchainImageSize.height);
+						m_context.setScissor(0, 0, swapchainImageSize.width, swapchainImageSize.height);
+
+						auto& bindState = m_recorderBindStates[recorderIndex];
+						auto chunkEntries = entries.subspan(firstDraw, drawCount);
+
+						if (isDepthPrePass) {
+							recordDepthPrePassCommands(bindState, chunkEntries);
+						}
+						else {
+							recordDirectDrawCommands(bindState, chunkEntries);
+						}
+					}
+				);
+			}
+		);
+
+		m_context.executeSecondaryGraphicsCommands(recorderCount);
+
+		for (auto& bindState : m_recorderBindStates) {
+			addBindCounts(bindState);
+		}
+	}
+
+	void Renderer::recordInstancedDrawCommands(BindState& bindState, const Scene& scene, const Matrix4& viewProjection) {
+		m_meshInstancesList.resize(m_meshArena.getMeshCount());
+
+		for (auto& meshInstances : m_meshInstancesList) {
+			meshInstances.clear();
+		}
+
+		uint32_t instanceCount = 0;
+
+		auto frustum = Frustum::createFromViewProjection(viewProjection);
+
+		scene.forEachEntityAppearance(
+			[&](const Transform& transform, const Appearance& appearance) {
+				if (!isEntityDrawn(frustum, transform, appearance)) return;
+
+				m_meshInstancesList[appearance.getMeshIndex()].push_back(
+					InstanceData{
+						.transform = transform.getWorldTransformation(),
+						.color     = appearance.getColor()
+					}
+				);
+
+				instanceCount++;
+			}
+		);
+
+		if (instanceCount == 0) return;
+
+		m_instanceBuffer->reserve(instanceCount);
+
+		bindPipeline(bindState, *m_instancedPipeline);
+		m_instancedPipeline->pushConstants(
+			PushConstants{
+				.vertexStageConstants = VertexStagePushConstants{
+					.transform = viewProjection.toTransposed()
+				}
+			}
+		);
+
+		m_instanceBuffer->bind();
+		bindState.bufferBindCount++;
+
+		uint32_t firstInstance = 0;
+
+		for (size_t i = 0; i < m_meshInstancesList.size(); i++) {
+			auto& meshInstances = m_meshInstancesList[i];
+
+			if (meshInstances.empty()) continue;
+
+			auto meshInstanceCount = static_cast<uint32_t>(meshInstances.size());
+
+			m_instanceBuffer->write(firstInstance, meshInstances);
+
+			auto& meshRange = m_meshArena.getMeshRange(i);
+
+			bindMeshPage(bindState, meshRange.pageIndex);
+
+			m_context.drawIndexedInstanced(
+				meshRange.indexCount,
+				meshInstanceCount,
+				meshRange.firstIndex,
+				meshRange.vertexOffset,
+				firstInstance
+			);
+
+			firstInstance += meshInstanceCount;
+		}
+	}
+
+	void Renderer::recordCullingCommands(const Scene& scene, const Matrix4& viewProjection) {
+		m_cullingInstances.clear();
+		m_meshInstanceCounts.assign(m_meshArena.getMeshCount(), 0);
 
-		for (auto& mesh : meshes) {
-			list.emplace_back(
-				m_api.createVertexBuffer(m_context, mesh.vertices),
-				m_api.createIndexBuffer(m_context, mesh.faces)
+		scene.forEachEntityAppearance(
+			[&](const Transform& transform, const Appearance& appearance) {
+				if (!appearance.isVisible()) [[unlikely]] return;
+				if (!m_meshArena.isMeshLoaded(appearance.getMeshIndex())) [[unlikely]] return;
+
+				m_cullingInstances.push_back(
+					CullingInstanceData{
+						.transform = transform.getWorldTransformation(),
+						.color     = appearance.getColor(),
+						.drawIndex = static_cast<uint32_t>(appearance.getMeshIndex())
+					}
+				);
+
+				m_meshInstanceCounts[appearance.getMeshIndex()]++;
+			}
+		);
+
+		// Frustum culling happens on the device, so every submitted instance counts as drawn
+		m_drawnEntityCount = m_cullingInstances.size();
+
+		if (m_cullingInstances.empty()) return;
+
+		m_cullingDraws.clear();
+
+		uint32_t firstInstance = 0;
+
+		// One draw per mesh, each with room for all of its instances in case none are culled
+		for (size_t i = 0; i < m_meshInstanceCounts.size(); i++) {
+			m_cullingDraws.push_back(
+				CullingDraw{
+					.meshRange     = m_meshArena.getMeshRange(i),
+					.firstInstance = firstInstance
+				}
 			);
+
+			firstInstance += m_meshInstanceCounts[i];
 		}
 
-		return list;
+		m_cullingPipeline->cull(
+			Frustum::createFromViewProjection(viewProjection),
+			m_cullingDraws,
+			m_cullingInstances
+		);
+	}
+
+	void Renderer::recordGpuDrivenDrawCommands(BindState& bindState, const Matrix4& viewProjection) {
+		if (m_cullingInstances.empty()) return;
+
+		bindPipeline(bindState, *m_instancedPipeline);
+		m_instancedPipeline->pushConstants(
+			PushConstants{
+				.vertexStageConstants = VertexStagePushConstants{
+					.transform = viewProjection.toTransposed()
+				}
+			}
+		);
+
+		m_cullingPipeline->bindCulledInstances();
+		bindState.bufferBindCount++;
+
+		for (size_t i = 0; i < m_meshInstanceCounts.size(); i++) {
+			if (m_meshInstanceCounts[i] == 0) continue;
+
+			bindMeshPage(bindState, m_meshArena.getMeshRange(i).pageIndex);
+
+			m_cullingPipeline->drawCulled(static_cast<uint32_t>(i));
+		}
 	}
 }
@@ -0,0 +1,278 @@
+#include <Miracle/Application/JobSystem.hpp>
+
+#include <algorithm>
+
+#include <Miracle/Application/Tracer.hpp>
+
+namespace Miracle::Application {
+	thread_local size_t JobSystem::s_queueIndex = JobSystem::s_noQueueIndex;
+
+	JobSystem::JobSystem(size_t workerThreadCount) {
+		s_queueIndex = s_mainThreadQueueIndex;
+
+		m_queues.reserve(workerThreadCount + 1);
+
+		for (size_t i = 0; i < workerThreadCount + 1; i++) {
+			m_queues.push_back(std::make_unique<JobQueue>());
+		}
+
+		m_threads.reserve(workerThreadCount);
+
+		for (size_t i = 0; i < workerThreadCount; i++) {
+			m_threads.emplace_back([this, i]() { runWorker(i + 1); });
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			auto lock = std::unique_lock(m_sleepMutex);
+			m_stopping = true;
+		}
+
+		m_jobsAvailableCondition.notify_all();
+
+		for (auto& thread : m_threads) {
+			thread.join();
+		}
+
+		s_queueIndex = s_noQueueIndex;
+	}
+
+	void JobSystem::schedule(Job&& job, JobCounter& counter) {
+		counter.m_pendingJobCount.fetch_add(1, std::memory_order_relaxed);
+
+		enqueue(QueuedJob{ .job = std::move(job), .counter = &counter });
+	}
+
+	void JobSystem::scheduleAfter(JobCounter& dependency, Job&& job, JobCounter& counter) {
+		counter.m_pendingJobCount.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			auto lock = std::unique_lock(dependency.m_mutex);
+
+			if (!dependency.isDone()) {
+				dependency.m_continuations.push_back(
+					JobCounter::Continuation{ .job = std::move(job), .counter = &counter }
+				);
+
+				return;
+			}
+		}
+
+		enqueue(QueuedJob{ .job = std::move(job), .counter = &counter });
+	}
+
+	void JobSystem::scheduleInBackground(Job&& job, JobCounter& counter) {
+		counter.m_pendingJobCount.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			auto lock = std::unique_lock(m_backgroundJobsMutex);
+
+			m_backgroundJobs.push_back(QueuedJob{ .job = std::move(job), .counter = &counter });
+		}
+
+		m_queuedJobCount.fetch_add(1, std::memory_order_release);
+
+		{
+			auto lock = std::unique_lock(m_sleepMutex);
+		}
+
+		m_jobsAvailableCondition.notify_one();
+	}
+
+	void JobSystem::scheduleOnMainThread(Job&& job, JobCounter& counter) {
+		counter.m_pendingJobCount.fetch_add(1, std::memory_order_relaxed);
+
+		auto lock = std::unique_lock(m_mainThreadJobsMutex);
+
+		m_mainThreadJobs.push_back(QueuedJob{ .job = std::move(job), .counter = &counter });
+	}
+
+	void JobSystem::wait(JobCounter& counter) {
+		while (!counter.isDone()) {
+			if (isMainThread()) {
+				runMainThreadJobs();
+			}
+
+			if (!tryRunQueuedJob()) {
+				std::this_thread::yield();
+			}
+		}
+
+		auto lock = std::unique_lock(counter.m_mutex);
+
+		if (counter.m_jobException != nullptr) {
+			std::rethrow_exception(std::exchange(counter.m_jobException, nullptr));
+		}
+	}
+
+	void JobSystem::parallelFor(size_t count, const ParallelForJob& job) {
+		if (count == 0) return;
+
+		// Indices are grouped into a few jobs per thread, so that stealing can still balance uneven work
+		auto jobCount = std::min(count, (m_threads.size() + 1) * s_parallelForJobsPerThread);
+		auto indicesPerJob = (count + jobCount - 1) / jobCount;
+
+		auto counter = JobCounter();
+
+		for (size_t firstIndex = 0; firstIndex < count; firstIndex += indicesPerJob) {
+			auto lastIndex = std::min(firstIndex + indicesPerJob, count);
+
+			schedule(
+				[&job, firstIndex, lastIndex]() {
+					for (size_t i = firstIndex; i < lastIndex; i++) {
+						job(i);
+					}
+				},
+				counter
+			);
+		}
+
+		wait(counter);
+	}
+
+	void JobSystem::runMainThreadJobs() {
+		{
+			auto lock = std::unique_lock(m_mainThreadJobsMutex);
+
+			if (m_mainThreadJobs.empty()) return;
+
+			std::swap(m_mainThreadJobs, m_runningMainThreadJobs);
+		}
+
+		for (auto& queuedJob : m_runningMainThreadJobs) {
+			runJob(queuedJob);
+		}
+
+		m_runningMainThreadJobs.clear();
+	}
+
+	void JobSystem::runWorker(size_t queueIndex) {
+		s_queueIndex = queueIndex;
+
+		while (true) {
+			if (tryRunQueuedJob() || tryRunBackgroundJob()) continue;
+
+			auto lock = std::unique_lock(m_sleepMutex);
+
+			m_jobsAvailableCondition.wait(
+				lock,
+				[this]() { return m_stopping || m_queuedJobCount.load(std::memory_order_acquire) > 0; }
+			);
+
+			if (m_stopping) return;
+		}
+	}
+
+	void JobSystem::enqueue(QueuedJob&& queuedJob) {
+		// Threads without a queue of their own spread their jobs over the queues of the others
+		auto queueIndex = s_queueIndex != s_noQueueIndex
+			? s_queueIndex
+			: m_nextForeignQueueIndex.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+		m_queuedJobCount.fetch_add(1, std::memory_order_release);
+
+		{
+			auto& queue = *m_queues[queueIndex];
+			auto lock = std::unique_lock(queue.mutex);
+
+			queue.jobs.push_back(std::move(queuedJob));
+		}
+
+		{
+			auto lock = std::unique_lock(m_sleepMutex);
+		}
+
+		m_jobsAvailableCondition.notify_one();
+	}
+
+	bool JobSystem::tryRunQueuedJob() {
+		auto queuedJob = QueuedJob();
+		bool jobTaken = false;
+
+		// The own queue is run newest first while it is still warm in cache, and others are stolen from oldest first
+		if (s_queueIndex != s_noQueueIndex) {
+			auto& queue = *m_queues[s_queueIndex];
+			auto lock = std::unique_lock(queue.mutex);
+
+			if (!queue.jobs.empty()) {
+				queuedJob = std::move(queue.jobs.back());
+				queue.jobs.pop_back();
+				jobTaken = true;
+			}
+		}
+
+		for (size_t i = 1; i <= m_queues.size() && !jobTaken; i++) {
+			auto queueIndex = s_queueIndex != s_noQueueIndex ? s_queueIndex + i : i;
+			auto& queue = *m_queues[queueIndex % m_queues.size()];
+			auto lock = std::unique_lock(queue.mutex);
+
+			if (!queue.jobs.empty()) {
+				queuedJob = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+				jobTaken = true;
+			}
+		}
+
+		if (!jobTaken) return false;
+
+		m_queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+
+		runJob(queuedJob);
+
+		return true;
+	}
+
+	bool JobSystem::tryRunBackgroundJob() {
+		auto queuedJob = QueuedJob();
+
+		{
+			auto lock = std::unique_lock(m_backgroundJobsMutex);
+
+			if (m_backgroundJobs.empty()) return false;
+
+			queuedJob = std::move(m_backgroundJobs.front());
+			m_backgroundJobs.pop_front();
+		}
+
+		m_queuedJobCount.fetch_sub(1, std::memory_order_relaxed);
+
+		runJob(queuedJob);
+
+		return true;
+	}
+
+	void JobSystem::runJob(QueuedJob& queuedJob) {
+		try {
+			MIRACLE_TRACE_ZONE("JobSystem::job");
+
+			queuedJob.job();
+		}
+		catch (...) {
+			auto lock = std::unique_lock(queuedJob.counter->m_mutex);
+
+			if (queuedJob.counter->m_jobException == nullptr) {
+				queuedJob.counter->m_jobException = std::current_exception();
+			}
+		}
+
+		completeJob(*queuedJob.counter);
+	}
+
+	void JobSystem::completeJob(JobCounter& counter) {
+		auto continuations = std::vector<JobCounter::Continuation>();
+
+		// The counter is not touched once unlocked, as a waiting thread may then destroy it
+		{
+			auto lock = std::unique_lock(counter.m_mutex);
+
+			if (counter.m_pendingJobCount.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+			std::swap(continuations, counter.m_continuations);
+		}
+
+		for (auto& continuation : continuations) {
+			enqueue(QueuedJob{ .job = std::move(continuation.job), .counter = continuation.counter });
+		}
+	}
+}
@@ -1,16 +1,19 @@
 #include <Miracle/Application/Models/Scene.hpp>
 
+#include <Miracle/Application/Tracer.hpp>
+
 namespace Miracle::Application {
 	Scene::Scene(
 		IEcs& ecs,
+		JobSystem& jobSystem,
 		const SceneInitProps& initProps
 	) :
 		m_container(ecs.createContainer()),
-		m_backgroundColor(initProps.backgroundColor)
+		m_backgroundColor(initProps.backgroundColor),
+		m_systemScheduler(jobSystem),
+		m_transformHierarchy(m_container->getRegistry(), m_container->getTransformStore())
 	{
-		for (auto& entityConfig : initProps.entityConfigs) {
-			m_container->createEntity(entityConfig);
-		}
+		m_container->createEntities(initProps.entityConfigs);
 
 		m_container->setEntityCreatedCallback(std::function(initProps.entityCreatedCallback));
 		m_container->setEntityDestroyedCallback(std::function(initProps.entityDestroyedCallback));
@@ -28,33 +31,100 @@ namespace Miracle::Application {
 		return EntityContext(m_container->createEntity(config), *m_container.get());
 	}
 
+	std::vector<EntityId> Scene::createEntities(const EntityConfig& prototype, size_t count) {
+		return m_container->createEntities(prototype, count);
+	}
+
+	std::vector<EntityId> Scene::createEntities(std::span<const EntityConfig> configs) {
+		return m_container->createEntities(configs);
+	}
+
 	void Scene::scheduleEntityDestruction(EntityId entity) {
 		m_container->scheduleEntityDestruction(entity);
 	}
 
+	void Scene::scheduleEntitiesDestruction(std::span<const EntityId> entities) {
+		m_container->scheduleEntitiesDestruction(entities);
+	}
+
 	void Scene::destroyScheduledEntities() {
 		m_container->destroyScheduledEntities();
 	}
 
-	void Scene::forEachEntityCamera(
-		const std::function<void(const Transform&, const Camera&)>& forEach
-	) const {
-		m_container->forEachCamera(forEach);
+	PrefabId Scene::registerPrefab(const EntityConfig& config) {
+		return m_container->registerPrefab(config);
+	}
+
+	EntityContext Scene::instantiatePrefab(PrefabId prefabId) {
+		validatePrefabRegistered(prefabId);
+
+		return EntityContext(m_container->instantiatePrefab(prefabId), *m_container.get());
 	}
 
-	void Scene::forEachEntityAppearance(
-		const std::function<void(const Transform&, const Appearance&)>& forEach
-	) const {
-		m_container->forEachAppearance(forEach);
+	EntityContext Scene::instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig) {
+		validatePrefabRegistered(prefabId);
+
+		return EntityContext(m_container->instantiatePrefab(prefabId, transformConfig), *m_container.get());
+	}
+
+	std::vector<EntityId> Scene::instantiatePrefabs(PrefabId prefabId, size_t count) {
+		validatePrefabRegistered(prefabId);
+
+		return m_container->instantiatePrefabs(prefabId, count);
+	}
+
+	void Scene::setParent(EntityId child, EntityId parent) {
+		auto& registry = m_container->getRegistry();
+
+		if (!registry.valid(child) || !registry.all_of<Transform>(child)) [[unlikely]] {
+			throw SceneErrors::InvalidChildError();
+		}
+
+		if (
+			child == parent
+				|| !registry.valid(parent)
+				|| !registry.all_of<Transform>(parent)
+				|| m_transformHierarchy.isDescendant(parent, child)
+		) [[unlikely]] {
+			throw SceneErrors::InvalidParentError();
+		}
+
+		registry.emplace_or_replace<TransformParent>(child, parent);
+	}
+
+	void Scene::removeParent(EntityId child) {
+		auto& registry = m_container->getRegistry();
+
+		if (!registry.valid(child)) [[unlikely]] {
+			throw SceneErrors::InvalidChildError();
+		}
+
+		registry.remove<TransformParent>(child);
+	}
+
+	void Scene::removeSystem(SystemId systemId) {
+		m_systemScheduler.removeSystem(systemId);
 	}
 
 	void Scene::update() {
-		m_container->forEachBehavior(
-			[](BehaviorBase& behavior) {
-				behavior.act();
+		MIRACLE_TRACE_ZONE("Scene::update");
+
+		m_systemScheduler.update(*m_container.get());
+
+		forEachEntity<BehaviorPointer>(
+			[](BehaviorPointer& behavior) {
+				behavior->act();
 			}
 		);
 
 		destroyScheduledEntities();
+
+		m_transformHierarchy.update();
+	}
+
+	void Scene::validatePrefabRegistered(PrefabId prefabId) const {
+		if (static_cast<size_t>(prefabId) >= m_container->getPrefabCount()) [[unlikely]] {
+			throw SceneErrors::PrefabNotRegisteredError();
+		}
 	}
 }
@@ -15,6 +15,16 @@ namespace Miracle::Application {
 		m_updateCounter++;
 	}
 
+	void PerformanceCountingService::setFrameEntityCounts(size_t drawnEntityCount, size_t culledEntityCount) {
+		m_lastFrameDrawnEntityCount = drawnEntityCount;
+		m_lastFrameCulledEntityCount = culledEntityCount;
+	}
+
+	void PerformanceCountingService::setFrameBindCounts(size_t pipelineBindCount, size_t bufferBindCount) {
+		m_lastFramePipelineBindCount = pipelineBindCount;
+		m_lastFrameBufferBindCount = bufferBindCount;
+	}
+
 	void PerformanceCountingService::updateCounters() {
 		auto currentTime = std::chrono::duration_cast<std::chrono::seconds>(
 			m_multimediaFramework.getDurationSinceInitialization()
@@ -27,6 +37,10 @@ namespace Miracle::Application {
 		m_previousCounterUpdate = currentTime;
 		m_fps = std::exchange(m_frameCounter, 0);
 		m_ups = std::exchange(m_updateCounter, 0);
+		m_drawnEntityCount = m_lastFrameDrawnEntityCount;
+		m_culledEntityCount = m_lastFrameCulledEntityCount;
+		m_pipelineBindCount = m_lastFramePipelineBindCount;
+		m_bufferBindCount = m_lastFrameBufferBindCount;
 		m_callback();
 	}
 
@@ -3,8 +3,9 @@
 namespace Miracle::Application {
 	SceneManager::SceneManager(
 		IEcs& ecs,
+		JobSystem& jobSystem,
 		const SceneInitProps& firstSceneInitProps
 	) :
-		m_currentScene(ecs, firstSceneInitProps)
+		m_currentScene(ecs, jobSystem, firstSceneInitProps)
 	{}
 }
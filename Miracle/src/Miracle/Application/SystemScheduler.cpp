@@ -0,0 +1,118 @@
+#include <Miracle/Application/SystemScheduler.hpp>
+
+#include <Miracle/Application/Tracer.hpp>
+
+namespace Miracle::Application {
+	SystemScheduler::SystemScheduler(JobSystem& jobSystem) :
+		m_jobSystem(jobSystem)
+	{}
+
+	void SystemScheduler::removeSystem(SystemId systemId) {
+		std::erase_if(m_systems, [&](const System& system) { return system.id == systemId; });
+
+		m_stagesOutdated = true;
+	}
+
+	void SystemScheduler::update(IEcsContainer& container) {
+		MIRACLE_TRACE_ZONE("SystemScheduler::update");
+
+		if (m_stagesOutdated) {
+			createStages();
+		}
+
+		auto& registry = container.getRegistry();
+		size_t commandBufferCount = 0;
+
+		for (auto& stage : m_stages) {
+			m_chunks.clear();
+
+			for (auto systemIndex : stage) {
+				auto entities = m_systems[systemIndex].getIteratedEntities(registry);
+
+				for (size_t i = 0; i < entities.size(); i += s_chunkEntityCount) {
+					m_chunks.push_back(
+						Chunk{
+							.systemIndex = systemIndex,
+							.entities    = entities.subspan(i, std::min(s_chunkEntityCount, entities.size() - i))
+						}
+					);
+				}
+			}
+
+			// Each chunk records into its own command buffer, so they are merged in the same order every update
+			auto firstCommandBufferIndex = commandBufferCount;
+			commandBufferCount += m_chunks.size();
+
+			if (m_commandBuffers.size() < commandBufferCount) {
+				m_commandBuffers.resize(commandBufferCount);
+			}
+
+			m_jobSystem.parallelFor(
+				m_chunks.size(),
+				[&](size_t chunkIndex) {
+					auto& chunk = m_chunks[chunkIndex];
+
+					m_systems[chunk.systemIndex].updateChunk(
+						registry,
+						chunk.entities,
+						m_commandBuffers[firstCommandBufferIndex + chunkIndex]
+					);
+				}
+			);
+		}
+
+		applyCommandBuffers(container, commandBufferCount);
+	}
+
+	bool SystemScheduler::isConflicting(const System& system, const System& otherSystem) {
+		auto isOverlapping = [](const std::vector<ComponentTypeId>& components, const std::vector<ComponentTypeId>& otherComponents) {
+			return std::ranges::find_first_of(components, otherComponents) != components.end();
+		};
+
+		return isOverlapping(system.writeComponents, otherSystem.writeComponents)
+			|| isOverlapping(system.writeComponents, otherSystem.readComponents)
+			|| isOverlapping(system.readComponents, otherSystem.writeComponents);
+	}
+
+	void SystemScheduler::createStages() {
+		m_stages.clear();
+
+		auto systemStageIndices = std::vector<size_t>(m_systems.size());
+
+		for (size_t i = 0; i < m_systems.size(); i++) {
+			size_t stageIndex = 0;
+
+			for (size_t j = 0; j < i; j++) {
+				if (isConflicting(m_systems[i], m_systems[j])) {
+					stageIndex = std::max(stageIndex, systemStageIndices[j] + 1);
+				}
+			}
+
+			systemStageIndices[i] = stageIndex;
+
+			if (stageIndex >= m_stages.size()) {
+				m_stages.resize(stageIndex + 1);
+			}
+
+			m_stages[stageIndex].push_back(i);
+		}
+
+		m_stagesOutdated = false;
+	}
+
+	void SystemScheduler::applyCommandBuffers(IEcsContainer& container, size_t commandBufferCount) {
+		for (size_t i = 0; i < commandBufferCount; i++) {
+			auto& commandBuffer = m_commandBuffers[i];
+
+			if (commandBuffer.isEmpty()) continue;
+
+			if (!commandBuffer.getCreatedEntityConfigs().empty()) {
+				container.createEntities(commandBuffer.getCreatedEntityConfigs());
+			}
+
+			container.scheduleEntitiesDestruction(commandBuffer.getDestroyedEntities());
+
+			commandBuffer.clear();
+		}
+	}
+}
@@ -0,0 +1,102 @@
+#include <Miracle/Application/Tracer.hpp>
+
+#include <algorithm>
+#include <format>
+
+namespace Miracle::Application {
+	const Tracer::Clock::time_point Tracer::s_startTime = Tracer::Clock::now();
+	std::mutex Tracer::s_threadBuffersMutex;
+	std::vector<std::unique_ptr<Tracer::ThreadBuffer>> Tracer::s_threadBuffers;
+	thread_local Tracer::ThreadBuffer* Tracer::s_currentThreadBuffer = nullptr;
+
+	void Tracer::addEvent(const char* name, uint64_t beginTime, uint64_t endTime) {
+		auto& threadBuffer = s_currentThreadBuffer != nullptr
+			? *s_currentThreadBuffer
+			: registerCurrentThread();
+
+		auto eventIndex = threadBuffer.writtenEventCount.load(std::memory_order_relaxed);
+		auto& eventSlot = threadBuffer.eventSlots[eventIndex % s_threadEventCapacity];
+
+		// Pairs with the fence of a trace reading the slot, so that one seeing the new fields also sees the count before them
+		std::atomic_thread_fence(std::memory_order_release);
+
+		eventSlot.name.store(name, std::memory_order_relaxed);
+		eventSlot.beginTime.store(beginTime, std::memory_order_relaxed);
+		eventSlot.duration.store(endTime - beginTime, std::memory_order_relaxed);
+
+		threadBuffer.writtenEventCount.store(eventIndex + 1, std::memory_order_release);
+	}
+
+	std::string Tracer::createChromeTraceJson() {
+		auto json = std::string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+		bool firstEvent = true;
+
+		auto lock = std::lock_guard(s_threadBuffersMutex);
+
+		for (auto& threadBuffer : s_threadBuffers) {
+			auto writtenEventCount = threadBuffer->writtenEventCount.load(std::memory_order_acquire);
+
+			auto events = std::vector<TraceEvent>();
+			events.reserve(static_cast<size_t>(std::min<uint64_t>(writtenEventCount, s_threadEventCapacity)));
+
+			auto firstEventIndex = writtenEventCount > s_threadEventCapacity
+				? writtenEventCount - s_threadEventCapacity
+				: 0;
+
+			for (auto i = firstEventIndex; i < writtenEventCount; i++) {
+				auto& eventSlot = threadBuffer->eventSlots[i % s_threadEventCapacity];
+
+				events.push_back(
+					TraceEvent{
+						.name      = eventSlot.name.load(std::memory_order_relaxed),
+						.beginTime = eventSlot.beginTime.load(std::memory_order_relaxed),
+						.duration  = eventSlot.duration.load(std::memory_order_relaxed)
+					}
+				);
+			}
+
+			// The thread may have overwritten the oldest events while they were copied, so those are dropped
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			auto latestEventCount = threadBuffer->writtenEventCount.load(std::memory_order_acquire);
+
+			auto firstValidEventIndex = latestEventCount + 1 > s_threadEventCapacity
+				? latestEventCount + 1 - s_threadEventCapacity
+				: 0;
+
+			for (size_t i = 0; i < events.size(); i++) {
+				if (firstEventIndex + i < firstValidEventIndex) continue;
+
+				auto& event = events[i];
+
+				json += std::format(
+					"{}{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+					firstEvent ? "" : ",",
+					event.name,
+					static_cast<double>(event.beginTime) / 1000.0,
+					static_cast<double>(event.duration) / 1000.0,
+					threadBuffer->threadIndex
+				);
+
+				firstEvent = false;
+			}
+		}
+
+		json += "]}";
+
+		return json;
+	}
+
+	Tracer::ThreadBuffer& Tracer::registerCurrentThread() {
+		auto threadBuffer = std::make_unique<ThreadBuffer>();
+		threadBuffer->eventSlots = std::make_unique<TraceEventSlot[]>(s_threadEventCapacity);
+
+		auto lock = std::lock_guard(s_threadBuffersMutex);
+
+		threadBuffer->threadIndex = static_cast<uint32_t>(s_threadBuffers.size());
+		s_currentThreadBuffer = threadBuffer.get();
+		s_threadBuffers.push_back(std::move(threadBuffer));
+
+		return *s_currentThreadBuffer;
+	}
+}
@@ -0,0 +1,199 @@
+#include <Miracle/Application/TransformHierarchy.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <utility>
+
+#include <Miracle/Common/Math/MathKernels.hpp>
+#include <Miracle/Application/Tracer.hpp>
+
+namespace Miracle::Application {
+	TransformHierarchy::TransformHierarchy(EcsRegistry& registry, TransformStore& transformStore) :
+		m_registry(registry),
+		m_transformStore(transformStore)
+	{
+		m_registry.on_construct<TransformParent>().connect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_update<TransformParent>().connect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_destroy<TransformParent>().connect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_destroy<Transform>().connect<&TransformHierarchy::onTransformDestroyed>(*this);
+	}
+
+	TransformHierarchy::~TransformHierarchy() {
+		m_registry.on_construct<TransformParent>().disconnect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_update<TransformParent>().disconnect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_destroy<TransformParent>().disconnect<&TransformHierarchy::onParentChanged>(*this);
+		m_registry.on_destroy<Transform>().disconnect<&TransformHierarchy::onTransformDestroyed>(*this);
+	}
+
+	bool TransformHierarchy::isDescendant(EntityId entity, EntityId ancestor) const {
+		auto transformParent = m_registry.try_get<TransformParent>(entity);
+
+		while (transformParent != nullptr) {
+			if (transformParent->getParent() == ancestor) return true;
+
+			transformParent = m_registry.try_get<TransformParent>(transformParent->getParent());
+		}
+
+		return false;
+	}
+
+	void TransformHierarchy::update() {
+		MIRACLE_TRACE_ZONE("TransformHierarchy::update");
+
+		if (m_childNodesOutdated) {
+			sortChildNodes();
+		}
+
+		updateOutdatedTransformations();
+		updateChildTransformations();
+
+		std::ranges::fill(m_transformStore.m_outdatedBits, 0);
+	}
+
+	void TransformHierarchy::onParentChanged(EcsRegistry& registry, EntityId entity) {
+		m_childNodesOutdated = true;
+
+		auto transform = registry.try_get<Transform>(entity);
+
+		if (transform != nullptr) {
+			m_transformStore.markOutdated(transform->m_index);
+		}
+	}
+
+	void TransformHierarchy::onTransformDestroyed(EcsRegistry&, EntityId entity) {
+		if (m_parentEntities.contains(entity)) {
+			m_childNodesOutdated = true;
+		}
+	}
+
+	void TransformHierarchy::sortChildNodes() {
+		// Children whose parent has been destroyed are placed in scene space by their own transform from now on
+		auto orphanedEntities = std::vector<EntityId>();
+
+		for (auto [entity, transformParent] : m_registry.view<TransformParent>().each()) {
+			auto parent = transformParent.getParent();
+
+			if (!m_registry.valid(parent) || !m_registry.all_of<Transform>(parent)) {
+				orphanedEntities.push_back(entity);
+			}
+		}
+
+		m_registry.remove<TransformParent>(orphanedEntities.begin(), orphanedEntities.end());
+
+		auto childNodeDepths = std::vector<std::pair<size_t, ChildNode>>();
+
+		m_parentEntities.clear();
+
+		for (auto [entity, transformParent, transform] : m_registry.view<TransformParent, Transform>().each()) {
+			m_parentEntities.insert(transformParent.getParent());
+
+			size_t depth = 0;
+
+			for (
+				auto ancestor = m_registry.try_get<TransformParent>(transformParent.getParent());
+				ancestor != nullptr;
+				ancestor = m_registry.try_get<TransformParent>(ancestor->getParent())
+			) {
+				depth++;
+			}
+
+			childNodeDepths.emplace_back(
+				depth,
+				ChildNode{
+					.transformIndex       = transform.m_index,
+					.parentTransformIndex = m_registry.get<Transform>(transformParent.getParent()).m_index
+				}
+			);
+		}
+
+		std::ranges::stable_sort(
+			childNodeDepths,
+			{},
+			[](const std::pair<size_t, ChildNode>& childNodeDepth) { return childNodeDepth.first; }
+		);
+
+		m_childNodes.clear();
+
+		for (auto& [depth, childNode] : childNodeDepths) {
+			m_childNodes.push_back(childNode);
+		}
+
+		m_childNodesOutdated = false;
+	}
+
+	void TransformHierarchy::updateOutdatedTransformations() {
+		auto& store = m_transformStore;
+		auto index = findOutdatedIndex(0, true);
+
+		// Consecutive outdated transforms of a page are composed as one batch, giving the world transformation of those without parent
+		while (index < store.getCapacity()) {
+			auto pageIndex = index / TransformStore::s_pageSize;
+			auto pageEndIndex = (pageIndex + 1) * TransformStore::s_pageSize;
+			auto endIndex = std::min(findOutdatedIndex(index, false), pageEndIndex);
+
+			auto& page = *store.m_pages[pageIndex];
+			auto pageOffset = index % TransformStore::s_pageSize;
+			auto count = endIndex - index;
+
+			MathKernels::createTransformations(
+				std::span(page.translations).subspan(pageOffset, count),
+				std::span(page.rotations).subspan(pageOffset, count),
+				std::span(page.scales).subspan(pageOffset, count),
+				std::span(page.worldTransformations).subspan(pageOffset, count)
+			);
+
+			index = findOutdatedIndex(endIndex, true);
+		}
+	}
+
+	void TransformHierarchy::updateChildTransformations() {
+		auto& store = m_transformStore;
+
+		// Parents are sorted before their children, so a changed parent has been updated before its children are
+		for (auto& childNode : m_childNodes) {
+			auto index = childNode.transformIndex;
+			bool outdated = store.isOutdated(index);
+
+			if (!outdated && !store.isOutdated(childNode.parentTransformIndex)) continue;
+
+			auto& worldTransformation = store.getWorldTransformation(index);
+
+			// Outdated children already hold their own transformation from the batch
+			auto transformation = outdated
+				? worldTransformation
+				: MathKernels::createTransformation(store.getTranslation(index), store.getRotation(index), store.getScale(index));
+
+			worldTransformation = MathKernels::multiply(
+				transformation,
+				store.getWorldTransformation(childNode.parentTransformIndex)
+			);
+
+			// Marked as outdated until the end of the update, so that its own children follow
+			store.markOutdated(index);
+		}
+	}
+
+	size_t TransformHierarchy::findOutdatedIndex(size_t firstIndex, bool outdated) const {
+		auto& outdatedBits = m_transformStore.m_outdatedBits;
+		auto capacity = m_transformStore.getCapacity();
+		auto firstWordIndex = firstIndex / TransformStore::s_bitsPerWord;
+
+		for (auto wordIndex = firstWordIndex; wordIndex < outdatedBits.size(); wordIndex++) {
+			auto word = outdated ? outdatedBits[wordIndex] : ~outdatedBits[wordIndex];
+
+			if (wordIndex == firstWordIndex) {
+				word &= ~uint64_t(0) << (firstIndex % TransformStore::s_bitsPerWord);
+			}
+
+			if (word != 0) {
+				return std::min(
+					wordIndex * TransformStore::s_bitsPerWord + static_cast<size_t>(std::countr_zero(word)),
+					capacity
+				);
+			}
+		}
+
+		return capacity;
+	}
+}
@@ -0,0 +1,535 @@
+#include <Miracle/Common/Math/MathKernels.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+	#define MIRACLE_MATH_KERNELS_AVX2
+	#define MIRACLE_MATH_KERNELS_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MIRACLE_MATH_KERNELS_SSE
+#endif
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+	#include <immintrin.h>
+#endif
+
+namespace Miracle {
+	static_assert(sizeof(Vector3) == 3 * sizeof(float));
+	static_assert(sizeof(Quaternion) == 4 * sizeof(float));
+	static_assert(sizeof(Matrix4) == 16 * sizeof(float));
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+	namespace {
+		const float* getData(const Quaternion& quaternion) { return &quaternion.w; }
+		const float* getData(const Matrix4& matrix) { return &matrix.m11; }
+		float* getData(Matrix4& matrix) { return &matrix.m11; }
+
+		template<int x, int y, int z, int w>
+		__m128 shuffle(__m128 vector) {
+			return _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(w, z, y, x));
+		}
+
+		__m128 loadVector3(const Vector3& vector) {
+			return _mm_set_ps(0.0f, vector.z, vector.y, vector.x);
+		}
+
+		Vector3 storeVector3(__m128 vector) {
+			alignas(16) float values[4];
+			_mm_store_ps(values, vector);
+
+			return Vector3{ .x = values[0], .y = values[1], .z = values[2] };
+		}
+
+		__m128 cross(__m128 lhs, __m128 rhs) {
+			return _mm_sub_ps(
+				_mm_mul_ps(shuffle<1, 2, 0, 3>(lhs), shuffle<2, 0, 1, 3>(rhs)),
+				_mm_mul_ps(shuffle<2, 0, 1, 3>(lhs), shuffle<1, 2, 0, 3>(rhs))
+			);
+		}
+
+		// Every row of the result only depends on the same row of the left hand side, so the two may alias
+		void multiplyRows(const float* lhs, const float* rhs, float* result) {
+#if defined(MIRACLE_MATH_KERNELS_AVX2)
+			auto rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs));
+			auto rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 4));
+			auto rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 8));
+			auto rhsRow4 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 12));
+
+			// Two rows of the left hand side are multiplied at a time, one per 128-bit lane
+			for (size_t i = 0; i < 16; i += 8) {
+				auto lhsRows = _mm256_loadu_ps(lhs + i);
+
+				auto resultRows = _mm256_mul_ps(_mm256_permute_ps(lhsRows, 0x00), rhsRow1);
+				resultRows = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows, 0x55), rhsRow2, resultRows);
+				resultRows = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows, 0xAA), rhsRow3, resultRows);
+				resultRows = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows, 0xFF), rhsRow4, resultRows);
+
+				_mm256_storeu_ps(result + i, resultRows);
+			}
+#else
+			auto rhsRow1 = _mm_loadu_ps(rhs);
+			auto rhsRow2 = _mm_loadu_ps(rhs + 4);
+			auto rhsRow3 = _mm_loadu_ps(rhs + 8);
+			auto rhsRow4 = _mm_loadu_ps(rhs + 12);
+
+			for (size_t i = 0; i < 16; i += 4) {
+				auto lhsRow = _mm_loadu_ps(lhs + i);
+
+				auto resultRow = _mm_mul_ps(shuffle<0, 0, 0, 0>(lhsRow), rhsRow1);
+				resultRow = _mm_add_ps(resultRow, _mm_mul_ps(shuffle<1, 1, 1, 1>(lhsRow), rhsRow2));
+				resultRow = _mm_add_ps(resultRow, _mm_mul_ps(shuffle<2, 2, 2, 2>(lhsRow), rhsRow3));
+				resultRow = _mm_add_ps(resultRow, _mm_mul_ps(shuffle<3, 3, 3, 3>(lhsRow), rhsRow4));
+
+				_mm_storeu_ps(result + i, resultRow);
+			}
+#endif
+		}
+
+		// Operations on packs of floats, so that the batch kernels below are written once for every vector width
+		struct SseOperations {
+			using Pack = __m128;
+
+			static constexpr size_t s_width = 4;
+
+			static Pack set(float value) { return _mm_set1_ps(value); }
+			static Pack add(Pack lhs, Pack rhs) { return _mm_add_ps(lhs, rhs); }
+			static Pack subtract(Pack lhs, Pack rhs) { return _mm_sub_ps(lhs, rhs); }
+			static Pack multiply(Pack lhs, Pack rhs) { return _mm_mul_ps(lhs, rhs); }
+			static Pack divide(Pack lhs, Pack rhs) { return _mm_div_ps(lhs, rhs); }
+			static Pack squareRoot(Pack value) { return _mm_sqrt_ps(value); }
+
+			// Takes the lanes of the first value where the mask is set and the lanes of the second one elsewhere
+			static Pack select(Pack mask, Pack first, Pack second) {
+				return _mm_or_ps(_mm_and_ps(mask, first), _mm_andnot_ps(mask, second));
+			}
+
+			static Pack notZero(Pack value) { return _mm_cmpneq_ps(value, _mm_setzero_ps()); }
+
+			static Pack gather(const float* values, size_t stride) {
+				return _mm_set_ps(values[3 * stride], values[2 * stride], values[stride], values[0]);
+			}
+
+			static void store(Pack value, float* values) { _mm_storeu_ps(values, value); }
+
+			// Transposes each group of four lanes, with the rows given as packs
+			static void transpose(Pack& row1, Pack& row2, Pack& row3, Pack& row4) {
+				_MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+			}
+
+			static Pack loadQuarters(const float* values, size_t) { return _mm_loadu_ps(values); }
+
+			static void storeQuarters(Pack value, float* values, size_t) { _mm_storeu_ps(values, value); }
+		};
+
+#if defined(MIRACLE_MATH_KERNELS_AVX2)
+		struct Avx2Operations {
+			using Pack = __m256;
+
+			static constexpr size_t s_width = 8;
+
+			static Pack set(float value) { return _mm256_set1_ps(value); }
+			static Pack add(Pack lhs, Pack rhs) { return _mm256_add_ps(lhs, rhs); }
+			static Pack subtract(Pack lhs, Pack rhs) { return _mm256_sub_ps(lhs, rhs); }
+			static Pack multiply(Pack lhs, Pack rhs) { return _mm256_mul_ps(lhs, rhs); }
+			static Pack divide(Pack lhs, Pack rhs) { return _mm256_div_ps(lhs, rhs); }
+			static Pack squareRoot(Pack value) { return _mm256_sqrt_ps(value); }
+
+			static Pack select(Pack mask, Pack first, Pack second) { return _mm256_blendv_ps(second, first, mask); }
+
+			static Pack notZero(Pack value) { return _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_NEQ_UQ); }
+
+			static Pack gather(const float* values, size_t stride) {
+				return _mm256_set_ps(
+					values[7 * stride],
+					values[6 * stride],
+					values[5 * stride],
+					values[4 * stride],
+					values[3 * stride],
+					values[2 * stride],
+					values[stride],
+					values[0]
+				);
+			}
+
+			static void store(Pack value, float* values) { _mm256_storeu_ps(values, value); }
+
+			static void transpose(Pack& row1, Pack& row2, Pack& row3, Pack& row4) {
+				auto low12 = _mm256_unpacklo_ps(row1, row2);
+				auto low34 = _mm256_unpacklo_ps(row3, row4);
+				auto high12 = _mm256_unpackhi_ps(row1, row2);
+				auto high34 = _mm256_unpackhi_ps(row3, row4);
+
+				row1 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(1, 0, 1, 0));
+				row2 = _mm256_shuffle_ps(low12, low34, _MM_SHUFFLE(3, 2, 3, 2));
+				row3 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(1, 0, 1, 0));
+				row4 = _mm256_shuffle_ps(high12, high34, _MM_SHUFFLE(3, 2, 3, 2));
+			}
+
+			// The low lane holds the four floats at the values, the high lane the four floats one stride further
+			static Pack loadQuarters(const float* values, size_t stride) {
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(values)), _mm_loadu_ps(values + stride), 1);
+			}
+
+			static void storeQuarters(Pack value, float* values, size_t stride) {
+				_mm_storeu_ps(values, _mm256_castps256_ps128(value));
+				_mm_storeu_ps(values + stride, _mm256_extractf128_ps(value, 1));
+			}
+		};
+
+		using WideOperations = Avx2Operations;
+#else
+		using WideOperations = SseOperations;
+#endif
+
+		// Computes one transformation per lane, with all values held as structures of arrays while computing
+		template<typename TOperations>
+		void createTransformationGroup(
+			const Vector3* translations,
+			const Quaternion* rotations,
+			const Vector3* scales,
+			Matrix4* results
+		) {
+			using O = TOperations;
+
+			// With wider packs, the second group of four is placed in the following lanes
+			constexpr size_t rotationGroupStride = 4 * 4;
+			constexpr size_t resultGroupStride = 4 * 16;
+
+			auto rotationData = getData(rotations[0]);
+
+			auto w = O::loadQuarters(rotationData, rotationGroupStride);
+			auto x = O::loadQuarters(rotationData + 4, rotationGroupStride);
+			auto y = O::loadQuarters(rotationData + 8, rotationGroupStride);
+			auto z = O::loadQuarters(rotationData + 12, rotationGroupStride);
+
+			O::transpose(w, x, y, z);
+
+			auto x2 = O::add(x, x);
+			auto y2 = O::add(y, y);
+			auto z2 = O::add(z, z);
+
+			auto xx = O::multiply(x, x2);
+			auto yy = O::multiply(y, y2);
+			auto zz = O::multiply(z, z2);
+			auto xy = O::multiply(x, y2);
+			auto xz = O::multiply(x, z2);
+			auto yz = O::multiply(y, z2);
+			auto wx = O::multiply(w, x2);
+			auto wy = O::multiply(w, y2);
+			auto wz = O::multiply(w, z2);
+
+			auto one = O::set(1.0f);
+			auto zero = O::set(0.0f);
+
+			auto scaleX = O::gather(&scales[0].x, 3);
+			auto scaleY = O::gather(&scales[0].y, 3);
+			auto scaleZ = O::gather(&scales[0].z, 3);
+
+			auto row1X = O::multiply(O::subtract(O::subtract(one, yy), zz), scaleX);
+			auto row1Y = O::multiply(O::add(xy, wz), scaleX);
+			auto row1Z = O::multiply(O::subtract(xz, wy), scaleX);
+			auto row1W = zero;
+
+			auto row2X = O::multiply(O::subtract(xy, wz), scaleY);
+			auto row2Y = O::multiply(O::subtract(O::subtract(one, zz), xx), scaleY);
+			auto row2Z = O::multiply(O::add(yz, wx), scaleY);
+			auto row2W = zero;
+
+			auto row3X = O::multiply(O::add(xz, wy), scaleZ);
+			auto row3Y = O::multiply(O::subtract(yz, wx), scaleZ);
+			auto row3Z = O::multiply(O::subtract(O::subtract(one, xx), yy), scaleZ);
+			auto row3W = zero;
+
+			auto row4X = O::gather(&translations[0].x, 3);
+			auto row4Y = O::gather(&translations[0].y, 3);
+			auto row4Z = O::gather(&translations[0].z, 3);
+			auto row4W = one;
+
+			O::transpose(row1X, row1Y, row1Z, row1W);
+			O::transpose(row2X, row2Y, row2Z, row2W);
+			O::transpose(row3X, row3Y, row3Z, row3W);
+			O::transpose(row4X, row4Y, row4Z, row4W);
+
+			// After transposing, each pack holds a row of one transformation per group of four lanes
+			typename O::Pack rows[] = {
+				row1X, row2X, row3X, row4X,
+				row1Y, row2Y, row3Y, row4Y,
+				row1Z, row2Z, row3Z, row4Z,
+				row1W, row2W, row3W, row4W
+			};
+
+			auto resultData = getData(results[0]);
+
+			for (size_t i = 0; i < 16; i++) {
+				O::storeQuarters(rows[i], resultData + i * 4, resultGroupStride);
+			}
+		}
+
+		template<typename TOperations>
+		void rotateVectorGroup(const Vector3* vectors, const Quaternion& rotation, Vector3* results) {
+			using O = TOperations;
+
+			auto w = O::set(rotation.w);
+			auto x = O::set(rotation.v.x);
+			auto y = O::set(rotation.v.y);
+			auto z = O::set(rotation.v.z);
+
+			auto vectorX = O::gather(&vectors[0].x, 3);
+			auto vectorY = O::gather(&vectors[0].y, 3);
+			auto vectorZ = O::gather(&vectors[0].z, 3);
+
+			// v' = v + w * t + q x t, where t = 2 * (q x v)
+			auto tX = O::multiply(O::set(2.0f), O::subtract(O::multiply(y, vectorZ), O::multiply(z, vectorY)));
+			auto tY = O::multiply(O::set(2.0f), O::subtract(O::multiply(z, vectorX), O::multiply(x, vectorZ)));
+			auto tZ = O::multiply(O::set(2.0f), O::subtract(O::multiply(x, vectorY), O::multiply(y, vectorX)));
+
+			auto resultX = O::add(
+				O::add(vectorX, O::multiply(w, tX)),
+				O::subtract(O::multiply(y, tZ), O::multiply(z, tY))
+			);
+			auto resultY = O::add(
+				O::add(vectorY, O::multiply(w, tY)),
+				O::subtract(O::multiply(z, tX), O::multiply(x, tZ))
+			);
+			auto resultZ = O::add(
+				O::add(vectorZ, O::multiply(w, tZ)),
+				O::subtract(O::multiply(x, tY), O::multiply(y, tX))
+			);
+
+			float resultXs[O::s_width];
+			float resultYs[O::s_width];
+			float resultZs[O::s_width];
+
+			O::store(resultX, resultXs);
+			O::store(resultY, resultYs);
+			O::store(resultZ, resultZs);
+
+			for (size_t i = 0; i < O::s_width; i++) {
+				results[i] = Vector3{ .x = resultXs[i], .y = resultYs[i], .z = resultZs[i] };
+			}
+		}
+
+		template<typename TOperations>
+		void normalizeGroup(Vector3* vectors) {
+			using O = TOperations;
+
+			auto x = O::gather(&vectors[0].x, 3);
+			auto y = O::gather(&vectors[0].y, 3);
+			auto z = O::gather(&vectors[0].z, 3);
+
+			auto lengthSquared = O::add(O::add(O::multiply(x, x), O::multiply(y, y)), O::multiply(z, z));
+			auto length = O::squareRoot(lengthSquared);
+
+			// Zero vectors are left as they are
+			auto mask = O::notZero(lengthSquared);
+
+			float resultXs[O::s_width];
+			float resultYs[O::s_width];
+			float resultZs[O::s_width];
+
+			O::store(O::select(mask, O::divide(x, length), x), resultXs);
+			O::store(O::select(mask, O::divide(y, length), y), resultYs);
+			O::store(O::select(mask, O::divide(z, length), z), resultZs);
+
+			for (size_t i = 0; i < O::s_width; i++) {
+				vectors[i] = Vector3{ .x = resultXs[i], .y = resultYs[i], .z = resultZs[i] };
+			}
+		}
+	}
+#endif
+
+	std::string_view MathKernels::getInstructionSet() {
+#if defined(MIRACLE_MATH_KERNELS_AVX2)
+		return "AVX2";
+#elif defined(MIRACLE_MATH_KERNELS_SSE)
+		return "SSE2";
+#else
+		return "Scalar";
+#endif
+	}
+
+	Matrix4 MathKernels::multiply(const Matrix4& lhs, const Matrix4& rhs) {
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		Matrix4 result;
+		multiplyRows(getData(lhs), getData(rhs), getData(result));
+
+		return result;
+#else
+		return lhs * rhs;
+#endif
+	}
+
+	Matrix4 MathKernels::createTransformation(
+		const Vector3& translation,
+		const Quaternion& rotation,
+		const Vector3& scale
+	) {
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		// Lanes hold w, x, y and z
+		auto q = _mm_loadu_ps(getData(rotation));
+		auto q2 = _mm_add_ps(q, q);
+
+		auto row1 = _mm_add_ps(
+			_mm_add_ps(
+				_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f),
+				_mm_mul_ps(
+					_mm_setr_ps(-1.0f, 1.0f, 1.0f, 0.0f),
+					_mm_mul_ps(shuffle<2, 1, 1, 0>(q), shuffle<2, 2, 3, 0>(q2))
+				)
+			),
+			_mm_mul_ps(
+				_mm_setr_ps(-1.0f, 1.0f, -1.0f, 0.0f),
+				_mm_mul_ps(shuffle<3, 0, 0, 0>(q), shuffle<3, 3, 2, 0>(q2))
+			)
+		);
+
+		auto row2 = _mm_add_ps(
+			_mm_add_ps(
+				_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f),
+				_mm_mul_ps(
+					_mm_setr_ps(1.0f, -1.0f, 1.0f, 0.0f),
+					_mm_mul_ps(shuffle<1, 1, 2, 0>(q), shuffle<2, 1, 3, 0>(q2))
+				)
+			),
+			_mm_mul_ps(
+				_mm_setr_ps(-1.0f, -1.0f, 1.0f, 0.0f),
+				_mm_mul_ps(shuffle<0, 3, 0, 0>(q), shuffle<3, 3, 1, 0>(q2))
+			)
+		);
+
+		auto row3 = _mm_add_ps(
+			_mm_add_ps(
+				_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f),
+				_mm_mul_ps(
+					_mm_setr_ps(1.0f, 1.0f, -1.0f, 0.0f),
+					_mm_mul_ps(shuffle<1, 2, 1, 0>(q), shuffle<3, 3, 1, 0>(q2))
+				)
+			),
+			_mm_mul_ps(
+				_mm_setr_ps(1.0f, -1.0f, -1.0f, 0.0f),
+				_mm_mul_ps(shuffle<0, 0, 2, 0>(q), shuffle<2, 1, 2, 0>(q2))
+			)
+		);
+
+		Matrix4 result;
+		auto resultData = getData(result);
+
+		_mm_storeu_ps(resultData, _mm_mul_ps(row1, _mm_set1_ps(scale.x)));
+		_mm_storeu_ps(resultData + 4, _mm_mul_ps(row2, _mm_set1_ps(scale.y)));
+		_mm_storeu_ps(resultData + 8, _mm_mul_ps(row3, _mm_set1_ps(scale.z)));
+		_mm_storeu_ps(resultData + 12, _mm_setr_ps(translation.x, translation.y, translation.z, 1.0f));
+
+		return result;
+#else
+		return Matrix4::createTransformation(translation, rotation, scale);
+#endif
+	}
+
+	Vector3 MathKernels::rotateVector(const Vector3& vector, const Quaternion& rotation) {
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		// Lanes hold x, y, z and w
+		auto q = shuffle<1, 2, 3, 0>(_mm_loadu_ps(getData(rotation)));
+		auto v = loadVector3(vector);
+
+		auto t = cross(q, v);
+		t = _mm_add_ps(t, t);
+
+		return storeVector3(
+			_mm_add_ps(
+				_mm_add_ps(v, _mm_mul_ps(shuffle<3, 3, 3, 3>(q), t)),
+				cross(q, t)
+			)
+		);
+#else
+		auto t = 2.0f * rotation.v.cross(vector);
+
+		return vector + rotation.w * t + rotation.v.cross(t);
+#endif
+	}
+
+	Vector3 MathKernels::toNormalized(const Vector3& vector) {
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		auto v = loadVector3(vector);
+		auto squares = _mm_mul_ps(v, v);
+
+		auto lengthSquared = _mm_add_ss(_mm_add_ss(squares, shuffle<1, 1, 1, 1>(squares)), shuffle<2, 2, 2, 2>(squares));
+
+		if (_mm_cvtss_f32(lengthSquared) == 0.0f) {
+			return vector;
+		}
+
+		auto length = _mm_sqrt_ss(lengthSquared);
+
+		return storeVector3(_mm_div_ps(v, shuffle<0, 0, 0, 0>(length)));
+#else
+		return vector.toNormalized();
+#endif
+	}
+
+	void MathKernels::multiply(std::span<const Matrix4> lhs, const Matrix4& rhs, std::span<Matrix4> results) {
+		// The right hand side is copied, in case it is one of the results
+		auto rhsCopy = rhs;
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		for (size_t i = 0; i < lhs.size(); i++) {
+			multiplyRows(getData(lhs[i]), getData(rhsCopy), getData(results[i]));
+		}
+#else
+		for (size_t i = 0; i < lhs.size(); i++) {
+			results[i] = lhs[i] * rhsCopy;
+		}
+#endif
+	}
+
+	void MathKernels::createTransformations(
+		std::span<const Vector3> translations,
+		std::span<const Quaternion> rotations,
+		std::span<const Vector3> scales,
+		std::span<Matrix4> results
+	) {
+		size_t i = 0;
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		for (; i + WideOperations::s_width <= rotations.size(); i += WideOperations::s_width) {
+			createTransformationGroup<WideOperations>(&translations[i], &rotations[i], &scales[i], &results[i]);
+		}
+#endif
+
+		for (; i < rotations.size(); i++) {
+			results[i] = createTransformation(translations[i], rotations[i], scales[i]);
+		}
+	}
+
+	void MathKernels::rotateVectors(
+		std::span<const Vector3> vectors,
+		const Quaternion& rotation,
+		std::span<Vector3> results
+	) {
+		size_t i = 0;
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		for (; i + WideOperations::s_width <= vectors.size(); i += WideOperations::s_width) {
+			rotateVectorGroup<WideOperations>(&vectors[i], rotation, &results[i]);
+		}
+#endif
+
+		for (; i < vectors.size(); i++) {
+			results[i] = rotateVector(vectors[i], rotation);
+		}
+	}
+
+	void MathKernels::normalize(std::span<Vector3> vectors) {
+		size_t i = 0;
+
+#if defined(MIRACLE_MATH_KERNELS_SSE)
+		for (; i + WideOperations::s_width <= vectors.size(); i += WideOperations::s_width) {
+			normalizeGroup<WideOperations>(&vectors[i]);
+		}
+#endif
+
+		for (; i < vectors.size(); i++) {
+			vectors[i] = toNormalized(vectors[i]);
+		}
+	}
+}
@@ -1,5 +1,8 @@
 #include <Miracle/EngineDependencies.hpp>
 
+#include <algorithm>
+#include <thread>
+
 #include <Miracle/Common/UnicodeConverter.hpp>
 #include <Miracle/Application/Mappings.hpp>
 #include "Infrastructure/Persistance/FileSystem/FileAccess.hpp"
@@ -8,6 +11,7 @@
 #include "Infrastructure/Input/Glfw/Keyboard.hpp"
 #include "Infrastructure/Graphics/Vulkan/GraphicsApi.hpp"
 #include "Infrastructure/Graphics/Vulkan/GraphicsContext.hpp"
+#include "Infrastructure/Graphics/Vulkan/HeadlessTarget.hpp"
 #include "Infrastructure/Ecs/Entt/Ecs.hpp"
 
 namespace Miracle {
@@ -17,6 +21,7 @@ namespace Miracle {
 	using GlfwKeyboard = Infrastructure::Input::Glfw::Keyboard;
 	using VulkanGraphicsApi = Infrastructure::Graphics::Vulkan::GraphicsApi;
 	using VulkanGraphicsContext = Infrastructure::Graphics::Vulkan::GraphicsContext;
+	using VulkanHeadlessTarget = Infrastructure::Graphics::Vulkan::HeadlessTarget;
 	using EnttEcs = Infrastructure::Ecs::Entt::Ecs;
 
 	EngineDependencies::EngineDependencies(
@@ -31,7 +36,7 @@ namespace Miracle {
 			std::make_unique<FileSystemFileAccess>(logger)
 		),
 		m_multimediaFramework(
-			std::make_unique<GlfwMultimediaFramework>(logger)
+			std::make_unique<GlfwMultimediaFramework>(logger, windowConfig.headless)
 		),
 		m_window(
 			std::make_unique<GlfwWindow>(
@@ -48,27 +53,45 @@ namespace Miracle {
 				reinterpret_cast<GlfwWindow&>(*m_window.get())
 			)
 		),
+		m_headlessTarget(
+			windowConfig.headless
+				? std::make_unique<VulkanHeadlessTarget>(
+					static_cast<uint32_t>(windowConfig.size.width),
+					static_cast<uint32_t>(windowConfig.size.height)
+				)
+				: nullptr
+		),
 		m_graphicsApi(
 			std::make_unique<VulkanGraphicsApi>(logger)
 		),
 		m_graphicsContext(
 			m_graphicsApi->createGraphicsContext(
 				appName,
-				reinterpret_cast<GlfwWindow&>(*m_window.get())
+				*m_fileAccess.get(),
+				m_headlessTarget != nullptr
+					? *m_headlessTarget.get()
+					: reinterpret_cast<GlfwWindow&>(*m_window.get())
 			)
 		),
 		m_ecs(
 			std::make_unique<EnttEcs>()
 		),
+		// The main thread takes part in running jobs while waiting on them, so it is not counted as a worker
+		m_jobSystem(
+			std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1
+		),
 		m_renderer(
 			logger,
 			*m_fileAccess.get(),
 			*m_graphicsApi.get(),
 			*m_graphicsContext.get(),
+			m_frameProfiler,
+			m_jobSystem,
 			Application::Mappings::toRendererInitProps(rendererConfig)
 		),
 		m_sceneManager(
 			*m_ecs.get(),
+			m_jobSystem,
 			Application::Mappings::toSceneInitProps(sceneConfig)
 		),
 		m_textInputService(eventDispatcher),
@@ -1,5 +1,7 @@
 #include "EcsContainer.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -8,49 +10,130 @@
 #include <Miracle/Common/Components/Camera.hpp>
 #include <Miracle/Common/Components/Appearance.hpp>
 #include <Miracle/Common/Components/Behavior.hpp>
+#include <Miracle/Application/Tracer.hpp>
 
 namespace Miracle::Infrastructure::Ecs::Entt {
 	EntityId EcsContainer::createEntity(const EntityConfig& config) {
 		auto entity = m_registry.create();
 
+		emplaceComponents(entity, config);
+
+		m_entityCreatedCallback(std::span(&entity, 1));
+		return entity;
+	}
+
+	std::vector<EntityId> EcsContainer::createEntities(const EntityConfig& prototype, size_t count) {
+		return insertPrefabs(createPrefab(prototype), count);
+	}
+
+	std::vector<EntityId> EcsContainer::createEntities(std::span<const EntityConfig> configs) {
+		MIRACLE_TRACE_ZONE("EcsContainer::createEntities");
+
+		auto entities = std::vector<EntityId>(configs.size());
+
+		if (entities.empty()) return entities;
+
+		m_registry.create(entities.begin(), entities.end());
+
+		for (size_t i = 0; i < entities.size(); i++) {
+			emplaceComponents(entities[i], configs[i]);
+		}
+
+		m_entityCreatedCallback(entities);
+		return entities;
+	}
+
+	PrefabId EcsContainer::registerPrefab(const EntityConfig& config) {
+		m_prefabs.push_back(createPrefab(config));
+
+		return PrefabId(m_prefabs.size() - 1);
+	}
+
+	EntityId EcsContainer::instantiatePrefab(PrefabId prefabId) {
+		auto& prefab = m_prefabs[static_cast<size_t>(prefabId)];
+		auto entity = m_registry.create();
+
+		emplacePrefabComponents(entity, prefab, prefab.transformConfig);
+
+		m_entityCreatedCallback(std::span(&entity, 1));
+		return entity;
+	}
+
+	EntityId EcsContainer::instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig) {
+		auto& prefab = m_prefabs[static_cast<size_t>(prefabId)];
+		auto entity = m_registry.create();
+
+		emplacePrefabComponents(entity, prefab, transformConfig);
+
+		m_entityCreatedCallback(std::span(&entity, 1));
+		return entity;
+	}
+
+	std::vector<EntityId> EcsContainer::instantiatePrefabs(PrefabId prefabId, size_t count) {
+		return insertPrefabs(m_prefabs[static_cast<size_t>(prefabId)], count);
+	}
+
+	void EcsContainer::scheduleEntityDestruction(EntityId entity) {
+		m_entitiesScheduledForDestruction.push_back(entity);
+	}
+
+	void EcsContainer::scheduleEntitiesDestruction(std::span<const EntityId> entities) {
+		m_entitiesScheduledForDestruction.insert(
+			m_entitiesScheduledForDestruction.end(),
+			entities.begin(),
+			entities.end()
+		);
+	}
+
+	void EcsContainer::destroyScheduledEntities() {
+		MIRACLE_TRACE_ZONE("EcsContainer::destroyScheduledEntities");
+
+		// Destructions scheduled by the destroyed callback are carried out as a following batch
+		while (!m_entitiesScheduledForDestruction.empty()) {
+			std::swap(m_entitiesScheduledForDestruction, m_destroyedEntities);
+
+			// Entities scheduled more than once, or already destroyed, are only destroyed once
+			std::ranges::sort(m_destroyedEntities);
+			auto duplicateEntities = std::ranges::unique(m_destroyedEntities);
+			m_destroyedEntities.erase(duplicateEntities.begin(), duplicateEntities.end());
+			std::erase_if(m_destroyedEntities, [&](EntityId entity) { return !m_registry.valid(entity); });
+
+			if (m_destroyedEntities.empty()) continue;
+
+			m_registry.destroy(m_destroyedEntities.begin(), m_destroyedEntities.end());
+			m_entityDestroyedCallback(m_destroyedEntities);
+
+			m_destroyedEntities.clear();
+		}
+	}
+
+	void EcsContainer::setEntityCreatedCallback(std::function<void(std::span<const EntityId>)>&& entityCreatedCallback) {
+		m_entityCreatedCallback = std::move(entityCreatedCallback);
+	}
+
+	void EcsContainer::unsetEntityCreatedCallback() {
+		m_entityCreatedCallback = [](std::span<const EntityId>) {};
+	}
+
+	void EcsContainer::setEntityDestroyedCallback(std::function<void(std::span<const EntityId>)>&& entityDestroyedCallback) {
+		m_entityDestroyedCallback = std::move(entityDestroyedCallback);
+	}
+
+	void EcsContainer::unsetEntityDestroyedCallback() {
+		m_entityDestroyedCallback = [](std::span<const EntityId>) {};
+	}
+
+	void EcsContainer::emplaceComponents(EntityId entity, const EntityConfig& config) {
 		m_registry.emplace<Transform>(
 			entity,
+			m_transformStore,
 			config.transformConfig.translation,
 			config.transformConfig.rotation,
 			config.transformConfig.scale
 		);
 
 		if (config.cameraConfig.has_value()) {
-			if (std::holds_alternative<OrthographicCameraConfig>(config.cameraConfig.value())) {
-				auto& cameraConfig = std::get<OrthographicCameraConfig>(config.cameraConfig.value());
-
-				m_registry.emplace<Camera>(
-					entity,
-					cameraConfig.zoomFactor,
-					cameraConfig.nearClipPlaneDistance,
-					cameraConfig.farClipPlaneDistance
-				);
-			}
-			else {
-				auto& cameraConfig = std::get<PerspectiveCameraConfig>(config.cameraConfig.value());
-
-				if (std::holds_alternative<Degrees>(cameraConfig.fieldOfView)) {
-					m_registry.emplace<Camera>(
-						entity,
-						std::get<Degrees>(cameraConfig.fieldOfView),
-						cameraConfig.nearClipPlaneDistance,
-						cameraConfig.farClipPlaneDistance
-					);
-				}
-				else {
-					m_registry.emplace<Camera>(
-						entity,
-						std::get<Radians>(cameraConfig.fieldOfView),
-						cameraConfig.nearClipPlaneDistance,
-						cameraConfig.farClipPlaneDistance
-					);
-				}
-			}
+			m_registry.emplace<Camera>(entity, createCamera(config.cameraConfig.value()));
 		}
 
 		if (config.appearanceConfig.has_value()) {
@@ -60,71 +143,149 @@ namespace Miracle::Infrastructure::Ecs::Entt {
 				entity,
 				appearanceConfig.visible,
 				appearanceConfig.meshIndex,
-				appearanceConfig.color
+				appearanceConfig.color,
+				appearanceConfig.materialIndex
 			);
 		}
-		
+
 		if (config.behaviorFactory.has_value()) {
-			m_registry.emplace<std::unique_ptr<BehaviorBase>>(
+			m_registry.emplace<BehaviorPointer>(
 				entity,
 				config.behaviorFactory.value().produce(
 					EntityContext(entity, *this)
 				)
 			);
 		}
-
-		m_entityCreatedCallback(entity);
-		return entity;
 	}
 
-	void EcsContainer::scheduleEntityDestruction(EntityId entity) {
-		m_entitiesScheduledForDestruction.emplace(entity);
-	}
+	Camera EcsContainer::createCamera(
+		const std::variant<OrthographicCameraConfig, PerspectiveCameraConfig>& cameraConfig
+	) {
+		if (std::holds_alternative<OrthographicCameraConfig>(cameraConfig)) {
+			auto& orthographicCameraConfig = std::get<OrthographicCameraConfig>(cameraConfig);
 
-	void EcsContainer::destroyScheduledEntities() {
-		for (auto entity : m_entitiesScheduledForDestruction) {
-			m_registry.destroy(entity);
-			m_entityDestroyedCallback(entity);
+			return Camera(
+				orthographicCameraConfig.zoomFactor,
+				orthographicCameraConfig.nearClipPlaneDistance,
+				orthographicCameraConfig.farClipPlaneDistance
+			);
 		}
 
-		m_entitiesScheduledForDestruction.clear();
-	}
+		auto& perspectiveCameraConfig = std::get<PerspectiveCameraConfig>(cameraConfig);
 
-	void EcsContainer::setEntityCreatedCallback(std::function<void(EntityId)>&& entityCreatedCallback) {
-		m_entityCreatedCallback = std::move(entityCreatedCallback);
-	}
+		if (std::holds_alternative<Degrees>(perspectiveCameraConfig.fieldOfView)) {
+			return Camera(
+				std::get<Degrees>(perspectiveCameraConfig.fieldOfView),
+				perspectiveCameraConfig.nearClipPlaneDistance,
+				perspectiveCameraConfig.farClipPlaneDistance
+			);
+		}
 
-	void EcsContainer::unsetEntityCreatedCallback() {
-		m_entityCreatedCallback = [](EntityId) {};
+		return Camera(
+			std::get<Radians>(perspectiveCameraConfig.fieldOfView),
+			perspectiveCameraConfig.nearClipPlaneDistance,
+			perspectiveCameraConfig.farClipPlaneDistance
+		);
 	}
 
-	void EcsContainer::setEntityDestroyedCallback(std::function<void(EntityId)>&& entityDestroyedCallback) {
-		m_entityDestroyedCallback = std::move(entityDestroyedCallback);
-	}
+	void EcsContainer::emplacePrefabComponents(
+		EntityId entity,
+		const Prefab& prefab,
+		const TransformConfig& transformConfig
+	) {
+		m_registry.emplace<Transform>(
+			entity,
+			m_transformStore,
+			transformConfig.translation,
+			transformConfig.rotation,
+			transformConfig.scale
+		);
 
-	void EcsContainer::unsetEntityDestroyedCallback() {
-		m_entityDestroyedCallback = [](EntityId) {};
-	}
+		if (prefab.camera.has_value()) {
+			m_registry.emplace<Camera>(entity, prefab.camera.value());
+		}
 
-	void EcsContainer::forEachCamera(
-		const std::function<void(const Transform&, const Camera&)>& forEach
-	) const {
-		for (auto [entity, transform, camera] : m_registry.view<Transform, Camera>().each()) {
-			forEach(transform, camera);
+		if (prefab.appearance.has_value()) {
+			m_registry.emplace<Appearance>(entity, prefab.appearance.value());
 		}
-	}
 
-	void EcsContainer::forEachAppearance(
-		const std::function<void(const Transform&, const Appearance&)>& forEach
-	) const {
-		for (auto [entity, transform, appearance] : m_registry.view<Transform, Appearance>().each()) {
-			forEach(transform, appearance);
+		if (prefab.behaviorFactory.has_value()) {
+			m_registry.emplace<BehaviorPointer>(
+				entity,
+				prefab.behaviorFactory.value().produce(
+					EntityContext(entity, *this)
+				)
+			);
 		}
 	}
 
-	void EcsContainer::forEachBehavior(const std::function<void(BehaviorBase&)>& forEach) {
-		for (auto [entity, behavior] : m_registry.view<std::unique_ptr<BehaviorBase>>().each()) {
-			forEach(*behavior.get());
+	std::vector<EntityId> EcsContainer::insertPrefabs(const Prefab& prefab, size_t count) {
+		MIRACLE_TRACE_ZONE("EcsContainer::insertPrefabs");
+
+		auto entities = std::vector<EntityId>(count);
+
+		if (entities.empty()) return entities;
+
+		m_registry.create(entities.begin(), entities.end());
+
+		// Transforms each own their values in the transform store, so they are moved into their storage as a range
+		auto transforms = std::vector<Transform>();
+		transforms.reserve(count);
+
+		for (size_t i = 0; i < count; i++) {
+			transforms.emplace_back(
+				m_transformStore,
+				prefab.transformConfig.translation,
+				prefab.transformConfig.rotation,
+				prefab.transformConfig.scale
+			);
+		}
+
+		m_registry.insert<Transform>(entities.begin(), entities.end(), std::make_move_iterator(transforms.begin()));
+
+		// The other components are copied into their storage as a range
+
+		if (prefab.camera.has_value()) {
+			m_registry.insert<Camera>(entities.begin(), entities.end(), prefab.camera.value());
+		}
+
+		if (prefab.appearance.has_value()) {
+			m_registry.insert<Appearance>(entities.begin(), entities.end(), prefab.appearance.value());
+		}
+
+		// Behaviors are bound to their entity, so each one is still produced separately
+		if (prefab.behaviorFactory.has_value()) {
+			auto& behaviorFactory = prefab.behaviorFactory.value();
+
+			for (auto entity : entities) {
+				m_registry.emplace<BehaviorPointer>(
+					entity,
+					behaviorFactory.produce(EntityContext(entity, *this))
+				);
+			}
 		}
+
+		m_entityCreatedCallback(entities);
+		return entities;
+	}
+
+	EcsContainer::Prefab EcsContainer::createPrefab(const EntityConfig& config) {
+		return Prefab{
+			.transformConfig = config.transformConfig,
+			.camera          = config.cameraConfig.has_value()
+				? std::optional(createCamera(config.cameraConfig.value()))
+				: std::nullopt,
+			.appearance      = config.appearanceConfig.has_value()
+				? std::optional(
+					Appearance(
+						config.appearanceConfig.value().visible,
+						config.appearanceConfig.value().meshIndex,
+						config.appearanceConfig.value().color,
+						config.appearanceConfig.value().materialIndex
+					)
+				)
+				: std::nullopt,
+			.behaviorFactory = config.behaviorFactory
+		};
 	}
 }
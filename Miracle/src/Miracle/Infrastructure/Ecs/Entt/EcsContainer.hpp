@@ -1,20 +1,38 @@
 #pragma once
 
-#include <set>
+#include <deque>
+#include <optional>
+#include <vector>
 #include <functional>
-
-#include <entt/entity/registry.hpp>
+#include <span>
+#include <variant>
 
 #include <Miracle/Application/IEcsContainer.hpp>
+#include <Miracle/Common/EcsRegistry.hpp>
+#include <Miracle/Common/TransformStore.hpp>
 #include <Miracle/Common/Models/EntityId.hpp>
+#include <Miracle/Common/Models/PrefabId.hpp>
+#include <Miracle/Common/Models/TransformConfig.hpp>
 
 namespace Miracle::Infrastructure::Ecs::Entt {
 	class EcsContainer : public Application::IEcsContainer {
 	private:
-		entt::basic_registry<EntityId> m_registry;
-		std::set<EntityId> m_entitiesScheduledForDestruction;
-		std::function<void(EntityId)> m_entityCreatedCallback = [](EntityId) {};
-		std::function<void(EntityId)> m_entityDestroyedCallback = [](EntityId) {};
+		// An entity config with its components already constructed, so that instances are copied from it
+		struct Prefab {
+			TransformConfig transformConfig;
+			std::optional<Camera> camera;
+			std::optional<Appearance> appearance;
+			std::optional<BehaviorFactory> behaviorFactory;
+		};
+
+		// Declared before the registry, as the transforms in the registry release their values from it when destroyed
+		TransformStore m_transformStore;
+		EcsRegistry m_registry;
+		std::vector<EntityId> m_entitiesScheduledForDestruction;
+		std::vector<EntityId> m_destroyedEntities;
+		std::deque<Prefab> m_prefabs;
+		std::function<void(std::span<const EntityId>)> m_entityCreatedCallback = [](std::span<const EntityId>) {};
+		std::function<void(std::span<const EntityId>)> m_entityDestroyedCallback = [](std::span<const EntityId>) {};
 
 	public:
 		virtual size_t getEntityCount() const override {
@@ -23,15 +41,31 @@ namespace Miracle::Infrastructure::Ecs::Entt {
 
 		virtual EntityId createEntity(const EntityConfig& config) override;
 
+		virtual std::vector<EntityId> createEntities(const EntityConfig& prototype, size_t count) override;
+
+		virtual std::vector<EntityId> createEntities(std::span<const EntityConfig> configs) override;
+
 		virtual void scheduleEntityDestruction(EntityId entity) override;
 
+		virtual void scheduleEntitiesDestruction(std::span<const EntityId> entities) override;
+
+		virtual size_t getPrefabCount() const override { return m_prefabs.size(); }
+
+		virtual PrefabId registerPrefab(const EntityConfig& config) override;
+
+		virtual EntityId instantiatePrefab(PrefabId prefabId) override;
+
+		virtual EntityId instantiatePrefab(PrefabId prefabId, const TransformConfig& transformConfig) override;
+
+		virtual std::vector<EntityId> instantiatePrefabs(PrefabId prefabId, size_t count) override;
+
 		virtual void destroyScheduledEntities() override;
 
-		virtual void setEntityCreatedCallback(std::function<void(EntityId)>&& entityCreatedCallback) override;
+		virtual void setEntityCreatedCallback(std::function<void(std::span<const EntityId>)>&& entityCreatedCallback) override;
 
 		virtual void unsetEntityCreatedCallback() override;
 
-		virtual void setEntityDestroyedCallback(std::function<void(EntityId)>&& entityDestroyedCallback) override;
+		virtual void setEntityDestroyedCallback(std::function<void(std::span<const EntityId>)>&& entityDestroyedCallback) override;
 
 		virtual void unsetEntityDestroyedCallback() override;
 
@@ -59,14 +93,21 @@ namespace Miracle::Infrastructure::Ecs::Entt {
 			return m_registry.get<Appearance>(entity);
 		}
 
-		virtual void forEachCamera(
-			const std::function<void(const Transform&, const Camera&)>& forEach
-		) const override;
+		virtual EcsRegistry& getRegistry() override { return m_registry; }
+
+		virtual const EcsRegistry& getRegistry() const override { return m_registry; }
+
+		virtual TransformStore& getTransformStore() override { return m_transformStore; }
+
+	private:
+		void emplaceComponents(EntityId entity, const EntityConfig& config);
+
+		void emplacePrefabComponents(EntityId entity, const Prefab& prefab, const TransformConfig& transformConfig);
+
+		std::vector<EntityId> insertPrefabs(const Prefab& prefab, size_t count);
 
-		virtual void forEachAppearance(
-			const std::function<void(const Transform&, const Appearance&)>& forEach
-		) const override;
+		static Prefab createPrefab(const EntityConfig& config);
 
-		virtual void forEachBehavior(const std::function<void(BehaviorBase&)>& forEach) override;
+		static Camera createCamera(const std::variant<OrthographicCameraConfig, PerspectiveCameraConfig>& cameraConfig);
 	};
 }
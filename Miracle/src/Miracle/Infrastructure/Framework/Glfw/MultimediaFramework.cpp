@@ -3,11 +3,21 @@
 #include <format>
 
 namespace Miracle::Infrastructure::Framework::Glfw {
-	MultimediaFramework::MultimediaFramework(Application::ILogger& logger) :
+	MultimediaFramework::MultimediaFramework(Application::ILogger& logger, bool useNullPlatform) :
 		m_logger(logger)
 	{
 		m_logger.info(std::format("Initializing GLFW version: {}", glfwGetVersionString()));
 
+		// The null platform creates windows without a display, so windowing keeps working when headless
+		if (useNullPlatform) {
+#if GLFW_VERSION_MAJOR > 3 || GLFW_VERSION_MINOR >= 4
+			glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+			m_logger.error("Failed to initialize GLFW\nThe null platform requires GLFW 3.4 or newer");
+			throw Application::MultimediaFrameworkErrors::InitError();
+#endif
+		}
+
 		bool initialized = glfwInit();
 
 		if (!initialized) {
@@ -11,7 +11,7 @@ namespace Miracle::Infrastructure::Framework::Glfw {
 		Application::ILogger& m_logger;
 
 	public:
-		MultimediaFramework(Application::ILogger& logger);
+		MultimediaFramework(Application::ILogger& logger, bool useNullPlatform);
 
 		~MultimediaFramework();
 
@@ -28,22 +28,22 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		);
 	}
 
-	std::pair<vk::Buffer, vma::Allocation> BufferUtilities::createBuffer(
+	std::pair<vk::Buffer, vma::Allocation> BufferUtilities::createReadbackBuffer(
 		GraphicsContext& m_context,
-		vk::BufferUsageFlags usage,
 		vk::DeviceSize bufferSize
 	) {
 		return m_context.getAllocator().createBuffer(
 			vk::BufferCreateInfo{
 				.flags                 = {},
 				.size                  = bufferSize,
-				.usage                 = usage | vk::BufferUsageFlagBits::eTransferDst,
+				.usage                 = vk::BufferUsageFlagBits::eTransferDst,
 				.sharingMode           = vk::SharingMode::eExclusive,
 				.queueFamilyIndexCount = 0,
 				.pQueueFamilyIndices   = nullptr
 			},
 			vma::AllocationCreateInfo{
-				.flags          = vma::AllocationCreateFlagBits::eDedicatedMemory,
+				.flags          = vma::AllocationCreateFlagBits::eHostAccessRandom
+					| vma::AllocationCreateFlagBits::eMapped,
 				.usage          = vma::MemoryUsage::eAuto,
 				.requiredFlags  = {},
 				.preferredFlags = {},
@@ -55,27 +55,30 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		);
 	}
 
-	void BufferUtilities::copyBuffer(
+	std::pair<vk::Buffer, vma::Allocation> BufferUtilities::createBuffer(
 		GraphicsContext& m_context,
-		vk::Buffer destination,
-		vk::Buffer source,
-		vk::DeviceSize size
+		vk::BufferUsageFlags usage,
+		vk::DeviceSize bufferSize
 	) {
-		m_context.recordTransferCommands(
-			[&]() {
-				m_context.getTransferCommandBuffer().copyBuffer(
-					source,
-					destination,
-					vk::BufferCopy{
-						.srcOffset = 0,
-						.dstOffset = 0,
-						.size = size
-					}
-				);
+		return m_context.getAllocator().createBuffer(
+			vk::BufferCreateInfo{
+				.flags                 = {},
+				.size                  = bufferSize,
+				.usage                 = usage | vk::BufferUsageFlagBits::eTransferDst,
+				.sharingMode           = vk::SharingMode::eExclusive,
+				.queueFamilyIndexCount = 0,
+				.pQueueFamilyIndices   = nullptr
+			},
+			vma::AllocationCreateInfo{
+				.flags          = vma::AllocationCreateFlagBits::eDedicatedMemory,
+				.usage          = vma::MemoryUsage::eAuto,
+				.requiredFlags  = {},
+				.preferredFlags = {},
+				.memoryTypeBits = {},
+				.pool           = nullptr,
+				.pUserData      = nullptr,
+				.priority       = 1.0f
 			}
 		);
-
-		m_context.submitTransferRecording();
-		m_context.waitForDeviceIdle();
 	}
 }
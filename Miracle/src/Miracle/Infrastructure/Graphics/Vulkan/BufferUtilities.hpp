@@ -16,17 +16,15 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			vk::DeviceSize bufferSize
 		);
 
-		static std::pair<vk::Buffer, vma::Allocation> createBuffer(
+		static std::pair<vk::Buffer, vma::Allocation> createReadbackBuffer(
 			GraphicsContext& m_context,
-			vk::BufferUsageFlags usage,
 			vk::DeviceSize bufferSize
 		);
 
-		static void copyBuffer(
+		static std::pair<vk::Buffer, vma::Allocation> createBuffer(
 			GraphicsContext& m_context,
-			vk::Buffer destination,
-			vk::Buffer source,
-			vk::DeviceSize size
+			vk::BufferUsageFlags usage,
+			vk::DeviceSize bufferSize
 		);
 	};
 }
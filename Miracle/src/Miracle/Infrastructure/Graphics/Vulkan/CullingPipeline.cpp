@@ -0,0 +1,304 @@
+#include "CullingPipeline.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+
+#include <format>
+
+#include <Miracle/Application/Graphics/InstanceData.hpp>
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	static_assert(
+		sizeof(Application::CullingInstanceData) == 80,
+		"Culling instance data must match the std430 layout of the culling compute shader"
+	);
+
+	static_assert(
+		sizeof(Application::InstanceData) == 19 * sizeof(float),
+		"Instance data must match the layout culled instances are written with"
+	);
+
+	CullingPipeline::CullingPipeline(
+		Application::ILogger& logger,
+		Application::IFileAccess& fileAccess,
+		GraphicsContext& context,
+		const Application::CullingPipelineInitProps& initProps
+	) :
+		m_logger(logger),
+		m_fileAccess(fileAccess),
+		m_context(context)
+	{
+		auto computeShaderBytecode = m_fileAccess.readFileAsBinary(initProps.computeShaderPath);
+		m_logger.info("Vulkan compute shader loaded successfully");
+
+		auto computeShaderModule = createShaderModule(computeShaderBytecode);
+
+		auto descriptorSetLayoutBindings = std::array<vk::DescriptorSetLayoutBinding, s_bindingCount>();
+
+		for (uint32_t i = 0; i < s_bindingCount; i++) {
+			descriptorSetLayoutBindings[i] = vk::DescriptorSetLayoutBinding{
+				.binding            = i,
+				.descriptorType     = vk::DescriptorType::eStorageBuffer,
+				.descriptorCount    = 1,
+				.stageFlags         = vk::ShaderStageFlagBits::eCompute,
+				.pImmutableSamplers = nullptr
+			};
+		}
+
+		auto framesInFlight = static_cast<uint32_t>(m_context.getFramesInFlight());
+
+		auto descriptorPoolSize = vk::DescriptorPoolSize{
+			.type            = vk::DescriptorType::eStorageBuffer,
+			.descriptorCount = s_bindingCount * framesInFlight
+		};
+
+		auto pushConstantRange = vk::PushConstantRange{
+			.stageFlags = vk::ShaderStageFlagBits::eCompute,
+			.offset     = 0,
+			.size       = sizeof(CullingPushConstants)
+		};
+
+		try {
+			m_descriptorSetLayout = m_context.getDevice().createDescriptorSetLayout(
+				vk::DescriptorSetLayoutCreateInfo{
+					.flags        = {},
+					.bindingCount = static_cast<uint32_t>(descriptorSetLayoutBindings.size()),
+					.pBindings    = descriptorSetLayoutBindings.data()
+				}
+			);
+
+			m_descriptorPool = m_context.getDevice().createDescriptorPool(
+				vk::DescriptorPoolCreateInfo{
+					.flags         = vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet,
+					.maxSets       = framesInFlight,
+					.poolSizeCount = 1,
+					.pPoolSizes    = &descriptorPoolSize
+				}
+			);
+
+			// One set per frame in flight, so a set is only rewritten once the device is done with it
+			auto descriptorSetLayouts = std::vector<vk::DescriptorSetLayout>(framesInFlight, *m_descriptorSetLayout);
+
+			m_descriptorSets = m_context.getDevice().allocateDescriptorSets(
+				vk::DescriptorSetAllocateInfo{
+					.descriptorPool     = *m_descriptorPool,
+					.descriptorSetCount = static_cast<uint32_t>(descriptorSetLayouts.size()),
+					.pSetLayouts        = descriptorSetLayouts.data()
+				}
+			);
+
+			m_layout = m_context.getDevice().createPipelineLayout(
+				vk::PipelineLayoutCreateInfo{
+					.flags                  = {},
+					.setLayoutCount         = 1,
+					.pSetLayouts            = &*m_descriptorSetLayout,
+					.pushConstantRangeCount = 1,
+					.pPushConstantRanges    = &pushConstantRange
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(std::format("Failed to create Vulkan culling pipeline layout.\n{}", e.what()));
+			throw Application::CullingPipelineErrors::CreationError();
+		}
+
+		auto creationStartTime = std::chrono::steady_clock::now();
+
+		try {
+			m_pipeline = m_context.getDevice().createComputePipeline(
+				m_context.getPipelineCache(),
+				vk::ComputePipelineCreateInfo{
+					.flags              = {},
+					.stage              = vk::PipelineShaderStageCreateInfo{
+						.flags               = {},
+						.stage               = vk::ShaderStageFlagBits::eCompute,
+						.module              = *computeShaderModule,
+						.pName               = "main",
+						.pSpecializationInfo = {}
+					},
+					.layout             = *m_layout,
+					.basePipelineHandle = nullptr,
+					.basePipelineIndex  = {}
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(std::format("Failed to create Vulkan culling pipeline.\n{}", e.what()));
+			throw Application::CullingPipelineErrors::CreationError();
+		}
+
+		auto creationDuration = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - creationStartTime
+		);
+
+		m_logger.info(
+			std::format(
+				"Vulkan culling pipeline created in {:.2f} ms with {} pipeline cache",
+				creationDuration.count(),
+				m_context.isPipelineCacheLoaded() ? "a loaded" : "an empty"
+			)
+		);
+	}
+
+	CullingPipeline::~CullingPipeline() {
+		m_logger.info("Destroying Vulkan culling pipeline...");
+	}
+
+	void CullingPipeline::cull(
+		const Application::Frustum& frustum,
+		std::span<const Application::CullingDraw> draws,
+		std::span<const Application::CullingInstanceData> instances
+	) {
+		if (draws.empty() || instances.empty()) [[unlikely]] return;
+
+		m_drawBounds.clear();
+		m_drawCommands.clear();
+
+		// Instance counts start at zero, the compute shader increments them for every visible instance
+		for (auto& draw : draws) {
+			m_drawBounds.push_back(
+				Vector4::createFromVector3(draw.meshRange.bounds.center, draw.meshRange.bounds.radius)
+			);
+
+			m_drawCommands.push_back(
+				vk::DrawIndexedIndirectCommand{
+					.indexCount    = draw.meshRange.indexCount,
+					.instanceCount = 0,
+					.firstIndex    = draw.meshRange.firstIndex,
+					.vertexOffset  = draw.meshRange.vertexOffset,
+					.firstInstance = draw.firstInstance
+				}
+			);
+		}
+
+		auto instanceCount = static_cast<uint32_t>(instances.size());
+
+		auto instancesAllocation = allocateAndWrite(instances.data(), instances.size_bytes());
+		auto drawBoundsAllocation = allocateAndWrite(m_drawBounds.data(), m_drawBounds.size() * sizeof(Vector4));
+
+		m_drawCommandsAllocation = allocateAndWrite(
+			m_drawCommands.data(),
+			m_drawCommands.size() * sizeof(vk::DrawIndexedIndirectCommand)
+		);
+
+		m_culledInstancesAllocation = m_context.getFrameAllocator().allocate(
+			static_cast<vk::DeviceSize>(instanceCount) * sizeof(Application::InstanceData)
+		);
+
+		auto bufferInfos = std::array{
+			vk::DescriptorBufferInfo{
+				.buffer = instancesAllocation.buffer,
+				.offset = instancesAllocation.offset,
+				.range  = instancesAllocation.size
+			},
+			vk::DescriptorBufferInfo{
+				.buffer = drawBoundsAllocation.buffer,
+				.offset = drawBoundsAllocation.offset,
+				.range  = drawBoundsAllocation.size
+			},
+			vk::DescriptorBufferInfo{
+				.buffer = m_drawCommandsAllocation.buffer,
+				.offset = m_drawCommandsAllocation.offset,
+				.range  = m_drawCommandsAllocation.size
+			},
+			vk::DescriptorBufferInfo{
+				.buffer = m_culledInstancesAllocation.buffer,
+				.offset = m_culledInstancesAllocation.offset,
+				.range  = m_culledInstancesAllocation.size
+			}
+		};
+
+		auto& descriptorSet = m_descriptorSets[m_context.getCurrentGraphicsCommandBufferIndex()];
+
+		auto descriptorWrites = std::array<vk::WriteDescriptorSet, s_bindingCount>();
+
+		for (uint32_t i = 0; i < s_bindingCount; i++) {
+			descriptorWrites[i] = vk::WriteDescriptorSet{
+				.dstSet           = *descriptorSet,
+				.dstBinding       = i,
+				.dstArrayElement  = 0,
+				.descriptorCount  = 1,
+				.descriptorType   = vk::DescriptorType::eStorageBuffer,
+				.pImageInfo       = nullptr,
+				.pBufferInfo      = &bufferInfos[i],
+				.pTexelBufferView = nullptr
+			};
+		}
+
+		m_context.getDevice().updateDescriptorSets(descriptorWrites, {});
+
+		auto& commandBuffer = m_context.getGraphicsCommandBuffer();
+
+		commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, *m_pipeline);
+		commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, *m_layout, 0, *descriptorSet, {});
+
+		commandBuffer.pushConstants<CullingPushConstants>(
+			*m_layout,
+			vk::ShaderStageFlagBits::eCompute,
+			0,
+			CullingPushConstants{
+				.frustumPlanes = frustum.planes,
+				.instanceCount = instanceCount
+			}
+		);
+
+		commandBuffer.dispatch((instanceCount + s_workgroupSize - 1) / s_workgroupSize, 1, 1);
+
+		commandBuffer.pipelineBarrier(
+			vk::PipelineStageFlagBits::eComputeShader,
+			vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eVertexInput,
+			{},
+			vk::MemoryBarrier{
+				.srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+				.dstAccessMask = vk::AccessFlagBits::eIndirectCommandRead
+					| vk::AccessFlagBits::eVertexAttributeRead
+			},
+			{},
+			{}
+		);
+	}
+
+	void CullingPipeline::bindCulledInstances() {
+		m_context.getGraphicsCommandBuffer().bindVertexBuffers(
+			1,
+			m_culledInstancesAllocation.buffer,
+			m_culledInstancesAllocation.offset
+		);
+	}
+
+	void CullingPipeline::drawCulled(uint32_t drawIndex) {
+		m_context.getGraphicsCommandBuffer().drawIndexedIndirect(
+			m_drawCommandsAllocation.buffer,
+			m_drawCommandsAllocation.offset + drawIndex * sizeof(vk::DrawIndexedIndirectCommand),
+			1,
+			sizeof(vk::DrawIndexedIndirectCommand)
+		);
+	}
+
+	FrameAllocation CullingPipeline::allocateAndWrite(const void* data, size_t size) const {
+		auto allocation = m_context.getFrameAllocator().allocate(size);
+
+		std::memcpy(allocation.mappedData, data, size);
+
+		m_context.getFrameAllocator().flush(allocation, 0, size);
+
+		return allocation;
+	}
+
+	vk::raii::ShaderModule CullingPipeline::createShaderModule(const std::vector<std::byte>& bytecode) const {
+		try {
+			return m_context.getDevice().createShaderModule(
+				vk::ShaderModuleCreateInfo{
+					.flags    = {},
+					.codeSize = bytecode.size(),
+					.pCode    = reinterpret_cast<const uint32_t*>(bytecode.data())
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(std::format("Failed to create Vulkan shader module for culling pipeline.\n{}", e.what()));
+			throw Application::CullingPipelineErrors::CreationError();
+		}
+	}
+}
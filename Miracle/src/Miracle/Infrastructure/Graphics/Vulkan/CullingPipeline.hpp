@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <Miracle/Common/Math/Vector4.hpp>
+#include <Miracle/Application/Graphics/ICullingPipeline.hpp>
+#include <Miracle/Application/ILogger.hpp>
+#include <Miracle/Application/IFileAccess.hpp>
+#include "Vulkan.hpp"
+#include "GraphicsContext.hpp"
+#include "FrameAllocator.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	class CullingPipeline : public Application::ICullingPipeline {
+	private:
+		struct CullingPushConstants {
+			std::array<Vector4, 6> frustumPlanes = {};
+			uint32_t instanceCount = 0;
+		};
+
+		static constexpr uint32_t s_workgroupSize = 64;
+		static constexpr uint32_t s_bindingCount = 4;
+
+		Application::ILogger& m_logger;
+		Application::IFileAccess& m_fileAccess;
+		GraphicsContext& m_context;
+
+		vk::raii::DescriptorSetLayout m_descriptorSetLayout = nullptr;
+		vk::raii::DescriptorPool m_descriptorPool = nullptr;
+		std::vector<vk::raii::DescriptorSet> m_descriptorSets;
+		vk::raii::PipelineLayout m_layout = nullptr;
+		vk::raii::Pipeline m_pipeline = nullptr;
+
+		std::vector<Vector4> m_drawBounds;
+		std::vector<vk::DrawIndexedIndirectCommand> m_drawCommands;
+		FrameAllocation m_drawCommandsAllocation = {};
+		FrameAllocation m_culledInstancesAllocation = {};
+
+	public:
+		CullingPipeline(
+			Application::ILogger& logger,
+			Application::IFileAccess& fileAccess,
+			GraphicsContext& context,
+			const Application::CullingPipelineInitProps& initProps
+		);
+
+		~CullingPipeline();
+
+		virtual void cull(
+			const Application::Frustum& frustum,
+			std::span<const Application::CullingDraw> draws,
+			std::span<const Application::CullingInstanceData> instances
+		) override;
+
+		virtual void bindCulledInstances() override;
+
+		virtual void drawCulled(uint32_t drawIndex) override;
+
+	private:
+		FrameAllocation allocateAndWrite(const void* data, size_t size) const;
+
+		vk::raii::ShaderModule createShaderModule(const std::vector<std::byte>& bytecode) const;
+	};
+}
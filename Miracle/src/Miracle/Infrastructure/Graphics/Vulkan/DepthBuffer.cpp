@@ -0,0 +1,129 @@
+#include "DepthBuffer.hpp"
+
+#include <exception>
+#include <format>
+
+#include <Miracle/Application/Graphics/ISwapchain.hpp>
+#include "GraphicsContext.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	DepthBuffer::DepthBuffer(
+		Application::ILogger& logger,
+		GraphicsContext& context
+	) :
+		m_logger(logger),
+		m_context(context),
+		m_format(selectFormat())
+	{
+		m_logger.info(std::format("Vulkan depth buffer format {} selected", vk::to_string(m_format)));
+	}
+
+	DepthBuffer::~DepthBuffer() {
+		destroy();
+	}
+
+	vk::AttachmentDescription DepthBuffer::getAttachmentDescription() const {
+		return vk::AttachmentDescription{
+			.flags          = {},
+			.format         = m_format,
+			.samples        = vk::SampleCountFlagBits::e1,
+			.loadOp         = vk::AttachmentLoadOp::eClear,
+			.storeOp        = vk::AttachmentStoreOp::eDontCare,
+			.stencilLoadOp  = vk::AttachmentLoadOp::eDontCare,
+			.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
+			.initialLayout  = vk::ImageLayout::eUndefined,
+			.finalLayout    = vk::ImageLayout::eDepthStencilAttachmentOptimal
+		};
+	}
+
+	void DepthBuffer::create(const vk::Extent2D& extent) {
+		try {
+			auto [image, allocation] = m_context.getAllocator().createImage(
+				vk::ImageCreateInfo{
+					.flags                 = {},
+					.imageType             = vk::ImageType::e2D,
+					.format                = m_format,
+					.extent                = vk::Extent3D{
+						.width  = extent.width,
+						.height = extent.height,
+						.depth  = 1
+					},
+					.mipLevels             = 1,
+					.arrayLayers           = 1,
+					.samples               = vk::SampleCountFlagBits::e1,
+					.tiling                = vk::ImageTiling::eOptimal,
+					.usage                 = vk::ImageUsageFlagBits::eDepthStencilAttachment,
+					.sharingMode           = vk::SharingMode::eExclusive,
+					.queueFamilyIndexCount = 0,
+					.pQueueFamilyIndices   = nullptr,
+					.initialLayout         = vk::ImageLayout::eUndefined
+				},
+				vma::AllocationCreateInfo{
+					.flags          = vma::AllocationCreateFlagBits::eDedicatedMemory,
+					.usage          = vma::MemoryUsage::eAutoPreferDevice,
+					.requiredFlags  = {},
+					.preferredFlags = {},
+					.memoryTypeBits = {},
+					.pool           = nullptr,
+					.pUserData      = nullptr,
+					.priority       = 1.0f
+				}
+			);
+
+			m_image = image;
+			m_allocation = allocation;
+
+			m_imageView = m_context.getDevice().createImageView(
+				vk::ImageViewCreateInfo{
+					.flags            = {},
+					.image            = m_image,
+					.viewType         = vk::ImageViewType::e2D,
+					.format           = m_format,
+					.components       = vk::ComponentMapping{
+						.r = vk::ComponentSwizzle::eIdentity,
+						.g = vk::ComponentSwizzle::eIdentity,
+						.b = vk::ComponentSwizzle::eIdentity,
+						.a = vk::ComponentSwizzle::eIdentity
+					},
+					.subresourceRange = vk::ImageSubresourceRange{
+						.aspectMask     = vk::ImageAspectFlagBits::eDepth,
+						.baseMipLevel   = 0,
+						.levelCount     = 1,
+						.baseArrayLayer = 0,
+						.layerCount     = 1
+					}
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			destroy();
+
+			m_logger.error(std::format("Failed to create Vulkan depth buffer.\n{}", e.what()));
+			throw Application::SwapchainErrors::CreationError();
+		}
+	}
+
+	void DepthBuffer::destroy() {
+		m_imageView.clear();
+
+		if (m_image) {
+			m_context.getAllocator().destroyImage(m_image, m_allocation);
+
+			m_image = nullptr;
+			m_allocation = nullptr;
+		}
+	}
+
+	vk::Format DepthBuffer::selectFormat() const {
+		for (auto format : s_formatCandidates) {
+			auto formatProperties = m_context.getPhysicalDevice().getFormatProperties(format);
+
+			if (formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eDepthStencilAttachment) {
+				return format;
+			}
+		}
+
+		m_logger.error("No depth format is supported by the Vulkan device");
+		throw Application::SwapchainErrors::CreationError();
+	}
+}
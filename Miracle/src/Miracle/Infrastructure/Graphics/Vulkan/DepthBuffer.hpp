@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+
+#include <Miracle/Application/ILogger.hpp>
+#include "Vulkan.hpp"
+#include "Vma.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	class GraphicsContext;
+
+	// Depth image of a swapchain, shared by all of its frame buffers as the render pass orders depth access between frames
+	class DepthBuffer {
+	private:
+		static constexpr auto s_formatCandidates = std::array{
+			vk::Format::eD32Sfloat,
+			vk::Format::eX8D24UnormPack32,
+			vk::Format::eD24UnormS8Uint,
+			vk::Format::eD16Unorm
+		};
+
+		Application::ILogger& m_logger;
+		GraphicsContext& m_context;
+
+		const vk::Format m_format;
+		vk::Image m_image = nullptr;
+		vma::Allocation m_allocation = nullptr;
+		vk::raii::ImageView m_imageView = nullptr;
+
+	public:
+		DepthBuffer(
+			Application::ILogger& logger,
+			GraphicsContext& context
+		);
+
+		~DepthBuffer();
+
+		vk::Format getFormat() const { return m_format; }
+
+		const vk::raii::ImageView& getImageView() const { return m_imageView; }
+
+		vk::AttachmentDescription getAttachmentDescription() const;
+
+		void create(const vk::Extent2D& extent);
+
+		void destroy();
+
+	private:
+		vk::Format selectFormat() const;
+	};
+}
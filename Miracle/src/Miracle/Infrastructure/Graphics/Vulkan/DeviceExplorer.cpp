@@ -24,13 +24,22 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		return DeviceInfo{
 			.name                  = properties.deviceName,
 			.type                  = properties.deviceType,
+			.vendorId              = properties.vendorID,
+			.deviceId              = properties.deviceID,
+			.driverVersion         = properties.driverVersion,
+			.pipelineCacheUuid     = properties.pipelineCacheUUID,
 			.deviceLocalMemorySize = memorySize,
 			.queueFamilyIndices    = queryQueueFamilyIndices(device, surface),
 			.extensionSupport      = queryExtensionSupport(device, surface)
 		};
 	}
 
-	bool DeviceExplorer::isDeviceSupported(const DeviceInfo& deviceInfo) {
+	bool DeviceExplorer::isDeviceSupported(const DeviceInfo& deviceInfo, bool requiresPresentation) {
+		if (!requiresPresentation) {
+			return deviceInfo.queueFamilyIndices.graphicsFamilyIndex.has_value()
+				&& deviceInfo.queueFamilyIndices.transferFamilyIndex.has_value();
+		}
+
 		return deviceInfo.queueFamilyIndices.graphicsFamilyIndex.has_value()
 			&& deviceInfo.queueFamilyIndices.presentFamilyIndex.has_value()
 			&& deviceInfo.queueFamilyIndices.transferFamilyIndex.has_value()
@@ -52,12 +61,15 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			if (
 				!queueFamilyIndices.graphicsFamilyIndex.has_value()
 					&& queueFamilyPropertiesList[i].queueFlags & vk::QueueFlagBits::eGraphics
+					&& queueFamilyPropertiesList[i].queueFlags & vk::QueueFlagBits::eCompute
 			) {
 				queueFamilyIndices.graphicsFamilyIndex = static_cast<uint32_t>(i);
 			}
 
+			// Without a surface nothing is presented, so no present queue is needed
 			if (
 				!queueFamilyIndices.presentFamilyIndex.has_value()
+					&& static_cast<bool>(*surface)
 					&& device.getSurfaceSupportKHR(i, *surface)
 			) {
 				queueFamilyIndices.presentFamilyIndex = static_cast<uint32_t>(i);
@@ -88,6 +100,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	) {
 		auto extensionSupport = DeviceExtensionSupport{};
 
+		if (!static_cast<bool>(*surface)) return extensionSupport;
+
 		for (auto& extensionProperties : device.enumerateDeviceExtensionProperties()) {
 			if (std::strcmp(extensionProperties.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0) {
 				extensionSupport.swapchainSupport = querySwapchainSupport(device, surface);
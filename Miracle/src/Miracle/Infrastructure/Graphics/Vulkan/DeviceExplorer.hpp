@@ -13,7 +13,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			const vk::raii::SurfaceKHR& surface
 		);
 
-		static bool isDeviceSupported(const DeviceInfo& deviceInfo);
+		static bool isDeviceSupported(const DeviceInfo& deviceInfo, bool requiresPresentation);
 
 	private:
 		static QueueFamilyIndices queryQueueFamilyIndices(
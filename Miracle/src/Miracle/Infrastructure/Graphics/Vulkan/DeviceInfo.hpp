@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <optional>
 #include <set>
@@ -53,6 +55,10 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	struct DeviceInfo {
 		std::string name = {};
 		vk::PhysicalDeviceType type = {};
+		uint32_t vendorId = {};
+		uint32_t deviceId = {};
+		uint32_t driverVersion = {};
+		std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUuid = {};
 		vk::DeviceSize deviceLocalMemorySize = {};
 		QueueFamilyIndices queueFamilyIndices = {};
 		DeviceExtensionSupport extensionSupport = {};
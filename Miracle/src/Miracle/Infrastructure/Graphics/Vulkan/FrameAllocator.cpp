@@ -0,0 +1,153 @@
+#include "FrameAllocator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <format>
+
+#include <Miracle/Application/Graphics/IGraphicsContext.hpp>
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	FrameAllocator::FrameAllocator(
+		Application::ILogger& logger,
+		const vma::Allocator& allocator,
+		size_t frameCount,
+		vk::DeviceSize minAlignment
+	) :
+		m_logger(logger),
+		m_allocator(allocator),
+		m_minAlignment(std::max<vk::DeviceSize>(minAlignment, 1))
+	{
+		m_frameBlocksList.resize(frameCount);
+
+		for (auto& frameBlocks : m_frameBlocksList) {
+			frameBlocks.push_back(createBlock(s_initialBlockSize));
+			m_stats.bytesReserved += s_initialBlockSize;
+		}
+
+		m_logger.info("Vulkan frame allocator created");
+	}
+
+	FrameAllocator::~FrameAllocator() {
+		m_logger.info("Destroying Vulkan frame allocator...");
+
+		for (auto& frameBlocks : m_frameBlocksList) {
+			for (auto& block : frameBlocks) {
+				destroyBlock(block);
+			}
+		}
+	}
+
+	void FrameAllocator::beginFrame(size_t frameIndex) {
+		vk::DeviceSize previousFrameUsedSize = 0;
+
+		for (auto& block : m_frameBlocksList[m_currentFrameIndex]) {
+			previousFrameUsedSize += block.usedSize;
+		}
+
+		m_stats.lastFrameBytesUsed = static_cast<size_t>(previousFrameUsedSize);
+		m_stats.peakFrameBytesUsed = std::max(m_stats.peakFrameBytesUsed, m_stats.lastFrameBytesUsed);
+
+		m_currentFrameIndex = frameIndex;
+
+		auto& frameBlocks = m_frameBlocksList[m_currentFrameIndex];
+
+		// Blocks added during the previous use of this frame slot are merged, so that it fits in one block from now on
+		if (frameBlocks.size() > 1) [[unlikely]] {
+			vk::DeviceSize mergedSize = 0;
+
+			for (auto& block : frameBlocks) {
+				mergedSize += block.size;
+				destroyBlock(block);
+			}
+
+			frameBlocks.clear();
+			frameBlocks.push_back(createBlock(mergedSize));
+
+			m_logger.info(std::format("Vulkan frame allocator block grown to {} bytes", mergedSize));
+		}
+
+		frameBlocks.front().usedSize = 0;
+	}
+
+	FrameAllocation FrameAllocator::allocate(vk::DeviceSize size, vk::DeviceSize alignment) {
+		alignment = std::max(alignment, m_minAlignment);
+
+		auto& frameBlocks = m_frameBlocksList[m_currentFrameIndex];
+
+		auto offset = (frameBlocks.back().usedSize + alignment - 1) / alignment * alignment;
+
+		if (offset + size > frameBlocks.back().size) [[unlikely]] {
+			frameBlocks.push_back(createBlock(std::max(size, frameBlocks.back().size * 2)));
+			offset = 0;
+
+			m_stats.bytesReserved += static_cast<size_t>(frameBlocks.back().size);
+		}
+
+		auto& block = frameBlocks.back();
+
+		block.usedSize = offset + size;
+
+		return FrameAllocation{
+			.buffer     = block.buffer,
+			.allocation = block.allocation,
+			.offset     = offset,
+			.size       = size,
+			.mappedData = static_cast<std::byte*>(block.mappedData) + offset
+		};
+	}
+
+	void FrameAllocator::flush(
+		const FrameAllocation& allocation,
+		vk::DeviceSize offset,
+		vk::DeviceSize size
+	) const {
+		m_allocator.flushAllocation(allocation.allocation, allocation.offset + offset, size);
+	}
+
+	FrameAllocator::Block FrameAllocator::createBlock(vk::DeviceSize size) const {
+		try {
+			auto [buffer, allocation] = m_allocator.createBuffer(
+				vk::BufferCreateInfo{
+					.flags                 = {},
+					.size                  = size,
+					.usage                 = s_bufferUsage,
+					.sharingMode           = vk::SharingMode::eExclusive,
+					.queueFamilyIndexCount = 0,
+					.pQueueFamilyIndices   = nullptr
+				},
+				vma::AllocationCreateInfo{
+					.flags          = vma::AllocationCreateFlagBits::eHostAccessSequentialWrite
+						| vma::AllocationCreateFlagBits::eMapped,
+					.usage          = vma::MemoryUsage::eAuto,
+					.requiredFlags  = {},
+					.preferredFlags = {},
+					.memoryTypeBits = {},
+					.pool           = nullptr,
+					.pUserData      = nullptr,
+					.priority       = 1.0f
+				}
+			);
+
+			return Block{
+				.buffer     = buffer,
+				.allocation = allocation,
+				.mappedData = m_allocator.getAllocationInfo(allocation).pMappedData,
+				.size       = size,
+				.usedSize   = 0
+			};
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create Vulkan frame allocator block.\n{}", e.what())
+			);
+
+			throw Application::GraphicsContextErrors::FrameAllocationError();
+		}
+	}
+
+	void FrameAllocator::destroyBlock(Block& block) const {
+		m_allocator.destroyBuffer(block.buffer, block.allocation);
+		block = Block{};
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Miracle/Application/ILogger.hpp>
+#include <Miracle/Application/Graphics/FrameAllocationStats.hpp>
+#include "Vulkan.hpp"
+#include "Vma.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	struct FrameAllocation {
+		vk::Buffer buffer = nullptr;
+		vma::Allocation allocation = nullptr;
+		vk::DeviceSize offset = 0;
+		vk::DeviceSize size = 0;
+		void* mappedData = nullptr;
+	};
+
+	// Sub-allocations are released all at once when their frame slot is begun again
+	class FrameAllocator {
+	private:
+		struct Block {
+			vk::Buffer buffer = nullptr;
+			vma::Allocation allocation = nullptr;
+			void* mappedData = nullptr;
+			vk::DeviceSize size = 0;
+			vk::DeviceSize usedSize = 0;
+		};
+
+		static constexpr vk::DeviceSize s_initialBlockSize = 4 * 1024 * 1024;
+		static constexpr auto s_bufferUsage = vk::BufferUsageFlagBits::eVertexBuffer
+			| vk::BufferUsageFlagBits::eIndexBuffer
+			| vk::BufferUsageFlagBits::eUniformBuffer
+			| vk::BufferUsageFlagBits::eStorageBuffer
+			| vk::BufferUsageFlagBits::eIndirectBuffer;
+
+		Application::ILogger& m_logger;
+		const vma::Allocator& m_allocator;
+		vk::DeviceSize m_minAlignment;
+
+		std::vector<std::vector<Block>> m_frameBlocksList;
+		size_t m_currentFrameIndex = 0;
+		Application::FrameAllocationStats m_stats = {};
+
+	public:
+		FrameAllocator(
+			Application::ILogger& logger,
+			const vma::Allocator& allocator,
+			size_t frameCount,
+			vk::DeviceSize minAlignment
+		);
+
+		~FrameAllocator();
+
+		const Application::FrameAllocationStats& getStats() const { return m_stats; }
+
+		// Must only be called once the device is done with the previous use of the frame slot
+		void beginFrame(size_t frameIndex);
+
+		FrameAllocation allocate(vk::DeviceSize size, vk::DeviceSize alignment = 0);
+
+		void flush(const FrameAllocation& allocation, vk::DeviceSize offset, vk::DeviceSize size) const;
+
+	private:
+		Block createBlock(vk::DeviceSize size) const;
+
+		void destroyBlock(Block& block) const;
+	};
+}
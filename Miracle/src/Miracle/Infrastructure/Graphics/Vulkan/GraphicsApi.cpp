@@ -2,9 +2,12 @@
 
 #include "GraphicsContext.hpp"
 #include "Swapchain.hpp"
+#include "OffscreenSwapchain.hpp"
 #include "GraphicsPipeline.hpp"
+#include "CullingPipeline.hpp"
 #include "VertexBuffer.hpp"
 #include "IndexBuffer.hpp"
+#include "InstanceBuffer.hpp"
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
 	GraphicsApi::GraphicsApi(Application::ILogger& logger) :
@@ -13,11 +16,13 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 	std::unique_ptr<Application::IGraphicsContext> GraphicsApi::createGraphicsContext(
 		const std::string_view& appName,
+		Application::IFileAccess& fileAccess,
 		Application::IContextTarget& target
 	) const {
 		return std::make_unique<GraphicsContext>(
 			appName,
 			m_logger,
+			fileAccess,
 			reinterpret_cast<IContextTarget&>(target)
 		);
 	}
@@ -26,45 +31,71 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		Application::IGraphicsContext& context,
 		const Application::SwapchainInitProps& initProps
 	) const {
-		return std::make_unique<Swapchain>(
+		auto& vulkanContext = reinterpret_cast<GraphicsContext&>(context);
+
+		if (vulkanContext.getTarget().isHeadless()) {
+			return std::make_unique<OffscreenSwapchain>(m_logger, vulkanContext, initProps);
+		}
+
+		return std::make_unique<Swapchain>(m_logger, vulkanContext, initProps);
+	}
+
+	std::unique_ptr<Application::IGraphicsPipeline> GraphicsApi::createGraphicsPipeline(
+		Application::IFileAccess& fileAccess,
+		Application::IGraphicsContext& context,
+		Application::ISwapchain& swapchain,
+		const Application::GraphicsPipelineInitProps& initProps
+	) const {
+		return std::make_unique<GraphicsPipeline>(
 			m_logger,
+			fileAccess,
 			reinterpret_cast<GraphicsContext&>(context),
+			reinterpret_cast<ISwapchain&>(swapchain),
 			initProps
 		);
 	}
 
-	std::unique_ptr<Application::IGraphicsPipeline> GraphicsApi::createGraphicsPipeline(
+	std::unique_ptr<Application::ICullingPipeline> GraphicsApi::createCullingPipeline(
 		Application::IFileAccess& fileAccess,
 		Application::IGraphicsContext& context,
-		Application::ISwapchain& swapchain
+		const Application::CullingPipelineInitProps& initProps
 	) const {
-		return std::make_unique<GraphicsPipeline>(
+		return std::make_unique<CullingPipeline>(
 			m_logger,
 			fileAccess,
 			reinterpret_cast<GraphicsContext&>(context),
-			reinterpret_cast<Swapchain&>(swapchain)
+			initProps
 		);
 	}
 
 	std::unique_ptr<Application::IVertexBuffer> GraphicsApi::createVertexBuffer(
 		Application::IGraphicsContext& context,
-		const std::vector<Vertex>& vertices
+		uint32_t vertexCapacity
 	) const {
 		return std::make_unique<VertexBuffer>(
 			m_logger,
 			reinterpret_cast<GraphicsContext&>(context),
-			vertices
+			vertexCapacity
 		);
 	}
 
 	std::unique_ptr<Application::IIndexBuffer> GraphicsApi::createIndexBuffer(
 		Application::IGraphicsContext& context,
-		const std::vector<Face>& faces
+		uint32_t faceCapacity
 	) const {
 		return std::make_unique<IndexBuffer>(
 			m_logger,
 			reinterpret_cast<GraphicsContext&>(context),
-			faces
+			faceCapacity
+		);
+	}
+
+	std::unique_ptr<Application::IInstanceBuffer> GraphicsApi::createInstanceBuffer(
+		Application::IGraphicsContext& context
+	) const {
+		return std::make_unique<InstanceBuffer>(
+			m_logger,
+			reinterpret_cast<GraphicsContext&>(context)
 		);
 	}
 }
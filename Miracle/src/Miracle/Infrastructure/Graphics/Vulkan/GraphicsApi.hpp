@@ -13,6 +13,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		virtual std::unique_ptr<Application::IGraphicsContext> createGraphicsContext(
 			const std::string_view& appName,
+			Application::IFileAccess& fileAccess,
 			Application::IContextTarget& target
 		) const override;
 
@@ -24,17 +25,28 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		virtual std::unique_ptr<Application::IGraphicsPipeline> createGraphicsPipeline(
 			Application::IFileAccess& fileAccess,
 			Application::IGraphicsContext& context,
-			Application::ISwapchain& swapchain
+			Application::ISwapchain& swapchain,
+			const Application::GraphicsPipelineInitProps& initProps
+		) const override;
+
+		virtual std::unique_ptr<Application::ICullingPipeline> createCullingPipeline(
+			Application::IFileAccess& fileAccess,
+			Application::IGraphicsContext& context,
+			const Application::CullingPipelineInitProps& initProps
 		) const override;
 
 		virtual std::unique_ptr<Application::IVertexBuffer> createVertexBuffer(
 			Application::IGraphicsContext& context,
-			const std::vector<Vertex>& vertices
+			uint32_t vertexCapacity
 		) const override;
 
 		virtual std::unique_ptr<Application::IIndexBuffer> createIndexBuffer(
 			Application::IGraphicsContext& context,
-			const std::vector<Face>& faces
+			uint32_t faceCapacity
+		) const override;
+
+		virtual std::unique_ptr<Application::IInstanceBuffer> createInstanceBuffer(
+			Application::IGraphicsContext& context
 		) const override;
 	};
 }
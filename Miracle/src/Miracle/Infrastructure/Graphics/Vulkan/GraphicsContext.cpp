@@ -1,20 +1,26 @@
 #include "GraphicsContext.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <exception>
 #include <limits>
 #include <format>
 
 #include <Miracle/Environment.hpp>
+#include <Miracle/Application/Tracer.hpp>
 #include "DeviceExplorer.hpp"
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
+	thread_local const vk::raii::CommandBuffer* GraphicsContext::s_secondaryGraphicsCommandBuffer = nullptr;
+
 	GraphicsContext::GraphicsContext(
 		const std::string_view& appName,
 		Application::ILogger& logger,
+		Application::IFileAccess& fileAccess,
 		IContextTarget& target
 	) :
 		m_logger(logger),
+		m_fileAccess(fileAccess),
 		m_target(target),
 		m_instance(createInstance(appName)),
 #ifdef MIRACLE_CONFIG_DEBUG
@@ -33,27 +39,34 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			0
 		);
 
-		m_presentQueue = m_device.getQueue(
-			m_deviceInfo.queueFamilyIndices.presentFamilyIndex.value(),
-			0
-		);
+		if (!m_target.isHeadless()) {
+			m_presentQueue = m_device.getQueue(
+				m_deviceInfo.queueFamilyIndices.presentFamilyIndex.value(),
+				0
+			);
+		}
 
 		m_transferQueue = m_device.getQueue(
 			m_deviceInfo.queueFamilyIndices.transferFamilyIndex.value(),
 			0
 		);
 
+		m_pipelineCache = createPipelineCache();
+
 		m_graphicsCommandPool = createCommandPool(m_deviceInfo.queueFamilyIndices.graphicsFamilyIndex.value());
 		m_transferCommandPool = createCommandPool(m_deviceInfo.queueFamilyIndices.transferFamilyIndex.value());
-		m_graphicsCommandBuffers = allocateCommandBuffers(m_graphicsCommandPool, 2);
+		m_graphicsCommandBuffers = allocateCommandBuffers(m_graphicsCommandPool, 2, vk::CommandBufferLevel::ePrimary);
 		m_transferCommandBuffer = std::move(
-			allocateCommandBuffers(m_transferCommandPool, 1)
+			allocateCommandBuffers(m_transferCommandPool, 1, vk::CommandBufferLevel::ePrimary)
 				.front()
 		);
 
 		m_graphicsCommandExecutionCompletedFences.reserve(m_graphicsCommandBuffers.size());
 		m_graphicsCommandExecutionCompletedSemaphores.reserve(m_graphicsCommandBuffers.size());
 		m_graphicsCommandPresentCompletedSemaphores.reserve(m_graphicsCommandBuffers.size());
+		m_secondaryGraphicsRecordersList.resize(m_graphicsCommandBuffers.size());
+		m_gpuTimingsWritten.resize(m_graphicsCommandBuffers.size(), false);
+		m_timestampQueryPool = createTimestampQueryPool();
 
 		for (size_t i = 0; i < m_graphicsCommandBuffers.size(); i++) {
 			m_graphicsCommandExecutionCompletedFences.push_back(createFence(true));
@@ -62,6 +75,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		}
 
 		m_allocator = createAllocator();
+		m_frameAllocator = createFrameAllocator();
+		m_uploadBatcher = std::make_unique<UploadBatcher>(m_logger, *this);
 
 		m_logger.info("Vulkan graphics context created");
 	}
@@ -69,6 +84,10 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	GraphicsContext::~GraphicsContext() {
 		m_logger.info("Destroying Vulkan graphics context...");
 
+		savePipelineCache();
+
+		m_uploadBatcher.reset();
+		m_frameAllocator.reset();
 		m_allocator.destroy();
 	}
 
@@ -116,11 +135,27 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		getGraphicsCommandBuffer().draw(vertexCount, 1, 0, 0);
 	}
 
-	void GraphicsContext::drawIndexed(uint32_t indexCount) {
-		getGraphicsCommandBuffer().drawIndexed(indexCount, 1, 0, 0, 0);
+	void GraphicsContext::drawIndexed(
+		uint32_t indexCount,
+		uint32_t firstIndex,
+		int32_t vertexOffset
+	) {
+		getGraphicsCommandBuffer().drawIndexed(indexCount, 1, firstIndex, vertexOffset, 0);
+	}
+
+	void GraphicsContext::drawIndexedInstanced(
+		uint32_t indexCount,
+		uint32_t instanceCount,
+		uint32_t firstIndex,
+		int32_t vertexOffset,
+		uint32_t firstInstance
+	) {
+		getGraphicsCommandBuffer().drawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 	}
 
 	void GraphicsContext::recordGraphicsCommands(const std::function<void()>& recording) {
+		MIRACLE_TRACE_ZONE("GraphicsContext::recordGraphicsCommands");
+
 		auto result = m_device.waitForFences(
 			*m_graphicsCommandExecutionCompletedFences[m_currentGraphicsCommandBufferIndex],
 			true,
@@ -131,6 +166,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			m_logger.warning("Timed out on waiting for Vulkan fence");
 		}
 
+		readGpuTimings();
+
+		m_frameAllocator->beginFrame(m_currentGraphicsCommandBufferIndex);
+		m_uploadBatcher->submitPendingUploads();
+
 		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].reset();
 		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].begin(
 			vk::CommandBufferBeginInfo{
@@ -139,6 +179,16 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			}
 		);
 
+		if (*m_timestampQueryPool) {
+			m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].resetQueryPool(
+				*m_timestampQueryPool,
+				static_cast<uint32_t>(m_currentGraphicsCommandBufferIndex * 2),
+				2
+			);
+		}
+
+		m_uploadBatcher->recordAcquireBarriers();
+
 		recording();
 
 		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].end();
@@ -158,19 +208,105 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		m_transferCommandBuffer.end();
 	}
 
+	void GraphicsContext::reserveSecondaryGraphicsRecorders(size_t recorderCount) {
+		for (auto& secondaryGraphicsRecorders : m_secondaryGraphicsRecordersList) {
+			while (secondaryGraphicsRecorders.size() < recorderCount) {
+				auto commandPool = createCommandPool(m_deviceInfo.queueFamilyIndices.graphicsFamilyIndex.value());
+
+				auto commandBuffer = std::move(
+					allocateCommandBuffers(commandPool, 1, vk::CommandBufferLevel::eSecondary)
+						.front()
+				);
+
+				secondaryGraphicsRecorders.push_back(
+					SecondaryGraphicsRecorder{
+						.commandPool   = std::move(commandPool),
+						.commandBuffer = std::move(commandBuffer)
+					}
+				);
+			}
+		}
+	}
+
+	void GraphicsContext::recordSecondaryGraphicsCommands(
+		size_t recorderIndex,
+		const std::function<void()>& recording
+	) {
+		auto& recorder = m_secondaryGraphicsRecordersList[m_currentGraphicsCommandBufferIndex][recorderIndex];
+
+		// Each recorder has its own pool, so no command pool is ever accessed by more than one thread
+		recorder.commandPool.reset();
+
+		auto inheritanceInfo = vk::CommandBufferInheritanceInfo{
+			.renderPass           = m_currentRenderPass,
+			.subpass              = 0,
+			.framebuffer          = m_currentFramebuffer,
+			.occlusionQueryEnable = false,
+			.queryFlags           = {},
+			.pipelineStatistics   = {}
+		};
+
+		recorder.commandBuffer.begin(
+			vk::CommandBufferBeginInfo{
+				.flags            = vk::CommandBufferUsageFlagBits::eRenderPassContinue
+					| vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+				.pInheritanceInfo = &inheritanceInfo
+			}
+		);
+
+		s_secondaryGraphicsCommandBuffer = &recorder.commandBuffer;
+
+		recording();
+
+		s_secondaryGraphicsCommandBuffer = nullptr;
+
+		recorder.commandBuffer.end();
+	}
+
+	void GraphicsContext::executeSecondaryGraphicsCommands(size_t recorderCount) {
+		auto& recorders = m_secondaryGraphicsRecordersList[m_currentGraphicsCommandBufferIndex];
+
+		auto commandBuffers = std::vector<vk::CommandBuffer>();
+		commandBuffers.reserve(recorderCount);
+
+		for (size_t i = 0; i < recorderCount; i++) {
+			commandBuffers.push_back(*recorders[i].commandBuffer);
+		}
+
+		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].executeCommands(commandBuffers);
+	}
+
 	void GraphicsContext::submitGraphicsRecording() {
-		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+		MIRACLE_TRACE_ZONE("GraphicsContext::submitGraphicsRecording");
+
+		bool headless = m_target.isHeadless();
+
+		auto waitSemaphores = std::vector<vk::Semaphore>();
+		auto waitStages = std::vector<vk::PipelineStageFlags>();
+
+		// Offscreen images are not acquired from a presentation engine, and their completion is tracked by fence only
+		if (!headless) {
+			waitSemaphores.push_back(*m_graphicsCommandPresentCompletedSemaphores[m_currentGraphicsCommandBufferIndex]);
+			waitStages.push_back(vk::PipelineStageFlagBits::eColorAttachmentOutput);
+		}
+
+		auto uploadCompletedWait = m_uploadBatcher->takeUploadCompletedWait();
+
+		if (uploadCompletedWait.has_value()) [[unlikely]] {
+			waitSemaphores.push_back(uploadCompletedWait->first);
+			waitStages.push_back(uploadCompletedWait->second);
+		}
 
 		m_device.resetFences(*m_graphicsCommandExecutionCompletedFences[m_currentGraphicsCommandBufferIndex]);
 
 		m_graphicsQueue.submit(
 			vk::SubmitInfo{
-				.waitSemaphoreCount   = 1,
-				.pWaitSemaphores      = &*m_graphicsCommandPresentCompletedSemaphores[m_currentGraphicsCommandBufferIndex],
-				.pWaitDstStageMask    = &waitStage,
+				.waitSemaphoreCount   = static_cast<uint32_t>(waitSemaphores.size()),
+				.pWaitSemaphores      = waitSemaphores.data(),
+				.pWaitDstStageMask    = waitStages.data(),
 				.commandBufferCount   = 1,
 				.pCommandBuffers      = &*m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex],
-				.signalSemaphoreCount = 1,
+				.signalSemaphoreCount = headless ? 0u : 1u,
 				.pSignalSemaphores    = &*m_graphicsCommandExecutionCompletedSemaphores[m_currentGraphicsCommandBufferIndex]
 			},
 			* m_graphicsCommandExecutionCompletedFences[m_currentGraphicsCommandBufferIndex]
@@ -195,6 +331,28 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		m_device.waitIdle();
 	}
 
+	void GraphicsContext::beginGpuTiming() {
+		if (!*m_timestampQueryPool) return;
+
+		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].writeTimestamp(
+			vk::PipelineStageFlagBits::eTopOfPipe,
+			*m_timestampQueryPool,
+			static_cast<uint32_t>(m_currentGraphicsCommandBufferIndex * 2)
+		);
+	}
+
+	void GraphicsContext::endGpuTiming() {
+		if (!*m_timestampQueryPool) return;
+
+		m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex].writeTimestamp(
+			vk::PipelineStageFlagBits::eBottomOfPipe,
+			*m_timestampQueryPool,
+			static_cast<uint32_t>(m_currentGraphicsCommandBufferIndex * 2 + 1)
+		);
+
+		m_gpuTimingsWritten[m_currentGraphicsCommandBufferIndex] = true;
+	}
+
 	SurfaceExtent GraphicsContext::getCurrentSurfaceExtent() const {
 		auto surfaceCapabilities = m_physicalDevice.getSurfaceCapabilitiesKHR(*m_surface);
 
@@ -404,7 +562,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		for (auto& device : allDevices) {
 			auto deviceInfo = DeviceExplorer::getDeviceInfo(device, m_surface);
 
-			if (!DeviceExplorer::isDeviceSupported(deviceInfo)) continue;
+			if (!DeviceExplorer::isDeviceSupported(deviceInfo, !m_target.isHeadless())) continue;
 
 			supportedDevices.emplace_back(&device, std::move(deviceInfo));
 		}
@@ -470,7 +628,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			);
 		}
 
-		auto extensionNames = std::array{ VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+		auto extensionNames = std::vector<const char*>();
+
+		if (!m_target.isHeadless()) {
+			extensionNames.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+		}
 
 		try {
 			return m_physicalDevice.createDevice(
@@ -494,6 +656,147 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		}
 	}
 
+	vk::raii::PipelineCache GraphicsContext::createPipelineCache() {
+		auto initialData = loadPipelineCacheData();
+
+		m_pipelineCacheLoaded = !initialData.empty();
+
+		try {
+			return m_device.createPipelineCache(
+				vk::PipelineCacheCreateInfo{
+					.flags           = {},
+					.initialDataSize = initialData.size(),
+					.pInitialData    = initialData.data()
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(std::format("Failed to create Vulkan pipeline cache.\n{}", e.what()));
+			throw Application::GraphicsContextErrors::CreationError();
+		}
+	}
+
+	vk::raii::QueryPool GraphicsContext::createTimestampQueryPool() {
+		auto graphicsFamilyIndex = m_deviceInfo.queueFamilyIndices.graphicsFamilyIndex.value();
+		auto queueFamilyPropertiesList = m_physicalDevice.getQueueFamilyProperties();
+
+		if (queueFamilyPropertiesList[graphicsFamilyIndex].timestampValidBits == 0) {
+			m_logger.warning("Vulkan graphics queue does not support timestamps. GPU timings will be unavailable");
+			return nullptr;
+		}
+
+		m_timestampPeriod = static_cast<double>(m_physicalDevice.getProperties().limits.timestampPeriod);
+
+		try {
+			return m_device.createQueryPool(
+				vk::QueryPoolCreateInfo{
+					.flags              = {},
+					.queryType          = vk::QueryType::eTimestamp,
+					.queryCount         = static_cast<uint32_t>(m_graphicsCommandBuffers.size() * 2),
+					.pipelineStatistics = {}
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(std::format("Failed to create Vulkan timestamp query pool.\n{}", e.what()));
+			throw Application::GraphicsContextErrors::CreationError();
+		}
+	}
+
+	void GraphicsContext::readGpuTimings() {
+		m_lastGpuTimingDuration = std::nullopt;
+
+		if (!m_gpuTimingsWritten[m_currentGraphicsCommandBufferIndex]) return;
+
+		m_gpuTimingsWritten[m_currentGraphicsCommandBufferIndex] = false;
+
+		// The frame slot's fence has been waited on, so its timestamps are available without waiting
+		auto [result, timestamps] = m_timestampQueryPool.getResults<uint64_t>(
+			static_cast<uint32_t>(m_currentGraphicsCommandBufferIndex * 2),
+			2,
+			2 * sizeof(uint64_t),
+			sizeof(uint64_t),
+			vk::QueryResultFlagBits::e64
+		);
+
+		if (result != vk::Result::eSuccess) [[unlikely]] return;
+
+		m_lastGpuTimingDuration = std::chrono::duration<double>(
+			static_cast<double>(timestamps[1] - timestamps[0]) * m_timestampPeriod * 1e-9
+		);
+	}
+
+	std::vector<std::byte> GraphicsContext::loadPipelineCacheData() const {
+		if (!m_fileAccess.fileExists(s_pipelineCachePath)) {
+			m_logger.info("No Vulkan pipeline cache found, starting with an empty cache");
+			return {};
+		}
+
+		auto fileData = std::vector<std::byte>();
+
+		try {
+			fileData = m_fileAccess.readFileAsBinary(s_pipelineCachePath);
+		}
+		catch (const FileAccessError&) {
+			m_logger.warning("Failed to read Vulkan pipeline cache, starting with an empty cache");
+			return {};
+		}
+
+		auto header = PipelineCacheHeader{};
+
+		if (fileData.size() < sizeof(header)) {
+			m_logger.warning("Vulkan pipeline cache is truncated, starting with an empty cache");
+			return {};
+		}
+
+		std::memcpy(&header, fileData.data(), sizeof(header));
+
+		// Cache data from another device or driver is at best useless and at worst rejected by the driver
+		if (
+			header.magic != s_pipelineCacheMagic
+				|| header.vendorId != m_deviceInfo.vendorId
+				|| header.deviceId != m_deviceInfo.deviceId
+				|| header.driverVersion != m_deviceInfo.driverVersion
+				|| header.pipelineCacheUuid != m_deviceInfo.pipelineCacheUuid
+				|| header.dataSize != fileData.size() - sizeof(header)
+		) {
+			m_logger.info("Vulkan pipeline cache does not match the current device, starting with an empty cache");
+			return {};
+		}
+
+		m_logger.info(std::format("Vulkan pipeline cache loaded with {} bytes", header.dataSize));
+
+		return std::vector<std::byte>(fileData.begin() + sizeof(header), fileData.end());
+	}
+
+	void GraphicsContext::savePipelineCache() const {
+		try {
+			auto cacheData = m_pipelineCache.getData();
+
+			auto header = PipelineCacheHeader{
+				.magic             = s_pipelineCacheMagic,
+				.vendorId          = m_deviceInfo.vendorId,
+				.deviceId          = m_deviceInfo.deviceId,
+				.driverVersion     = m_deviceInfo.driverVersion,
+				.pipelineCacheUuid = m_deviceInfo.pipelineCacheUuid,
+				.dataSize          = cacheData.size()
+			};
+
+			auto fileData = std::vector<std::byte>(sizeof(header) + cacheData.size());
+
+			std::memcpy(fileData.data(), &header, sizeof(header));
+			std::memcpy(fileData.data() + sizeof(header), cacheData.data(), cacheData.size());
+
+			m_fileAccess.writeFileAsBinary(s_pipelineCachePath, fileData);
+
+			m_logger.info(std::format("Vulkan pipeline cache saved with {} bytes", cacheData.size()));
+		}
+		catch (const std::exception& e) {
+			// Failing to save the cache only slows down the next startup
+			m_logger.warning(std::format("Failed to save Vulkan pipeline cache.\n{}", e.what()));
+		}
+	}
+
 	vk::raii::CommandPool GraphicsContext::createCommandPool(uint32_t queueFamilyIndex) const {
 		try {
 			return m_device.createCommandPool(
@@ -514,13 +817,14 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 	std::vector<vk::raii::CommandBuffer> GraphicsContext::allocateCommandBuffers(
 		vk::raii::CommandPool& commandPool,
-		size_t count
+		size_t count,
+		vk::CommandBufferLevel level
 	) const {
 		try {
 			return m_device.allocateCommandBuffers(
 				vk::CommandBufferAllocateInfo{
 					.commandPool        = *commandPool,
-					.level              = vk::CommandBufferLevel::ePrimary,
+					.level              = level,
 					.commandBufferCount = static_cast<uint32_t>(count)
 				}
 			);
@@ -590,4 +894,18 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			throw Application::GraphicsContextErrors::CreationError();
 		}
 	}
+
+	std::unique_ptr<FrameAllocator> GraphicsContext::createFrameAllocator() const {
+		auto deviceLimits = m_physicalDevice.getProperties().limits;
+
+		return std::make_unique<FrameAllocator>(
+			m_logger,
+			m_allocator,
+			m_graphicsCommandBuffers.size(),
+			std::max(
+				deviceLimits.minUniformBufferOffsetAlignment,
+				deviceLimits.minStorageBufferOffsetAlignment
+			)
+		);
+	}
 }
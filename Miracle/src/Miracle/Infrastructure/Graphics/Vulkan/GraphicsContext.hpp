@@ -5,24 +5,51 @@
 #include <utility>
 #include <array>
 #include <vector>
+#include <memory>
+#include <optional>
+#include <chrono>
 #include <cstdint>
 
 #include <Miracle/Definitions.hpp>
 #include <Miracle/Application/Graphics/IGraphicsContext.hpp>
 #include <Miracle/Application/ILogger.hpp>
+#include <Miracle/Application/IFileAccess.hpp>
 #include "Vulkan.hpp"
 #include "Vma.hpp"
 #include "IContextTarget.hpp"
 #include "DeviceInfo.hpp"
 #include "SurfaceExtent.hpp"
+#include "FrameAllocator.hpp"
+#include "UploadBatcher.hpp"
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
 	class GraphicsContext : public Application::IGraphicsContext {
 	private:
+		struct SecondaryGraphicsRecorder {
+			vk::raii::CommandPool commandPool = nullptr;
+			vk::raii::CommandBuffer commandBuffer = nullptr;
+		};
+
 		static constexpr uint32_t s_vulkanApiVersion = VK_API_VERSION_1_1;
 		static constexpr auto s_validationLayerNames = std::array{ "VK_LAYER_KHRONOS_validation" };
 
+		// Identifies pipeline cache files written by this engine
+		static constexpr uint32_t s_pipelineCacheMagic = 0x4D504331;
+		static constexpr auto s_pipelineCachePath = "PipelineCache.bin";
+
+		struct PipelineCacheHeader {
+			uint32_t magic = 0;
+			uint32_t vendorId = 0;
+			uint32_t deviceId = 0;
+			uint32_t driverVersion = 0;
+			std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUuid = {};
+			uint64_t dataSize = 0;
+		};
+
+		static thread_local const vk::raii::CommandBuffer* s_secondaryGraphicsCommandBuffer;
+
 		Application::ILogger& m_logger;
+		Application::IFileAccess& m_fileAccess;
 		IContextTarget& m_target;
 
 		vk::raii::Context m_context;
@@ -37,6 +64,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		vk::raii::Queue m_graphicsQueue = nullptr;
 		vk::raii::Queue m_presentQueue = nullptr;
 		vk::raii::Queue m_transferQueue = nullptr;
+		vk::raii::PipelineCache m_pipelineCache = nullptr;
+		bool m_pipelineCacheLoaded = false;
 		vk::raii::CommandPool m_graphicsCommandPool = nullptr;
 		vk::raii::CommandPool m_transferCommandPool = nullptr;
 		std::vector<vk::raii::CommandBuffer> m_graphicsCommandBuffers;
@@ -45,12 +74,22 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		std::vector<vk::raii::Semaphore> m_graphicsCommandExecutionCompletedSemaphores;
 		std::vector<vk::raii::Semaphore> m_graphicsCommandPresentCompletedSemaphores;
 		size_t m_currentGraphicsCommandBufferIndex = 0;
+		std::vector<std::vector<SecondaryGraphicsRecorder>> m_secondaryGraphicsRecordersList;
+		vk::raii::QueryPool m_timestampQueryPool = nullptr;
+		double m_timestampPeriod = 0.0;
+		std::vector<bool> m_gpuTimingsWritten;
+		std::optional<std::chrono::duration<double>> m_lastGpuTimingDuration = std::nullopt;
+		vk::RenderPass m_currentRenderPass = nullptr;
+		vk::Framebuffer m_currentFramebuffer = nullptr;
 		vma::Allocator m_allocator;
+		std::unique_ptr<FrameAllocator> m_frameAllocator;
+		std::unique_ptr<UploadBatcher> m_uploadBatcher;
 
 	public:
 		GraphicsContext(
 			const std::string_view& appName,
 			Application::ILogger& logger,
+			Application::IFileAccess& fileAccess,
 			IContextTarget& target
 		);
 
@@ -72,34 +111,82 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		virtual void draw(uint32_t vertexCount) override;
 
-		virtual void drawIndexed(uint32_t indexCount) override;
+		virtual void drawIndexed(
+			uint32_t indexCount,
+			uint32_t firstIndex,
+			int32_t vertexOffset
+		) override;
+
+		virtual void drawIndexedInstanced(
+			uint32_t indexCount,
+			uint32_t instanceCount,
+			uint32_t firstIndex,
+			int32_t vertexOffset,
+			uint32_t firstInstance
+		) override;
 
 		IContextTarget& getTarget() override { return m_target; }
 
+		virtual size_t getFramesInFlight() const override { return m_graphicsCommandBuffers.size(); }
+
 		virtual void recordGraphicsCommands(const std::function<void()>& recording) override;
 
 		virtual void recordTransferCommands(const std::function<void()>& recording) override;
 
+		virtual void reserveSecondaryGraphicsRecorders(size_t recorderCount) override;
+
+		virtual void recordSecondaryGraphicsCommands(
+			size_t recorderIndex,
+			const std::function<void()>& recording
+		) override;
+
+		virtual void executeSecondaryGraphicsCommands(size_t recorderCount) override;
+
 		virtual void submitGraphicsRecording() override;
 
 		virtual void submitTransferRecording() override;
 
 		virtual void waitForDeviceIdle() override;
 
+		virtual void beginGpuTiming() override;
+
+		virtual void endGpuTiming() override;
+
+		virtual std::optional<std::chrono::duration<double>> getLastGpuTimingDuration() const override {
+			return m_lastGpuTimingDuration;
+		}
+
+		virtual Application::FrameAllocationStats getFrameAllocationStats() const override {
+			return m_frameAllocator->getStats();
+		}
+
 		const vk::raii::SurfaceKHR& getSurface() const { return m_surface; }
 
+		const vk::raii::PhysicalDevice& getPhysicalDevice() const { return m_physicalDevice; }
+
 		const DeviceInfo& getDeviceInfo() const { return m_deviceInfo; }
 
 		const vk::raii::Device& getDevice() const { return m_device; }
 
+		const vk::raii::PipelineCache& getPipelineCache() const { return m_pipelineCache; }
+
+		// Whether the pipeline cache was filled from a previous run
+		bool isPipelineCacheLoaded() const { return m_pipelineCacheLoaded; }
+
 		const vk::raii::Queue& getGraphicsQueue() const { return m_graphicsQueue; }
 
 		const vk::raii::Queue& getPresentQueue() const { return m_presentQueue; }
 
 		const vk::raii::Queue& getTransferQueue() const { return m_transferQueue; }
 
+		size_t getGraphicsCommandBufferCount() const { return m_graphicsCommandBuffers.size(); }
+
+		size_t getCurrentGraphicsCommandBufferIndex() const { return m_currentGraphicsCommandBufferIndex; }
+
 		const vk::raii::CommandBuffer& getGraphicsCommandBuffer() const {
-			return m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex];
+			return s_secondaryGraphicsCommandBuffer != nullptr
+				? *s_secondaryGraphicsCommandBuffer
+				: m_graphicsCommandBuffers[m_currentGraphicsCommandBufferIndex];
 		}
 
 		const vk::raii::CommandBuffer& getTransferCommandBuffer() const {
@@ -116,6 +203,10 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		const vma::Allocator& getAllocator() const { return m_allocator; }
 
+		FrameAllocator& getFrameAllocator() { return *m_frameAllocator; }
+
+		UploadBatcher& getUploadBatcher() { return *m_uploadBatcher; }
+
 		SurfaceExtent getCurrentSurfaceExtent() const;
 
 		vk::SurfaceTransformFlagBitsKHR getCurrentSurfaceTransformation() const {
@@ -128,6 +219,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		void recreatePresentCompletedSemaphores();
 
+		void setCurrentRenderPass(vk::RenderPass renderPass, vk::Framebuffer framebuffer) {
+			m_currentRenderPass = renderPass;
+			m_currentFramebuffer = framebuffer;
+		}
+
 	private:
 		vk::raii::Instance createInstance(const std::string_view& appName);
 
@@ -152,11 +248,22 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		vk::raii::Device createDevice() const;
 
+		vk::raii::PipelineCache createPipelineCache();
+
+		vk::raii::QueryPool createTimestampQueryPool();
+
+		void readGpuTimings();
+
+		std::vector<std::byte> loadPipelineCacheData() const;
+
+		void savePipelineCache() const;
+
 		vk::raii::CommandPool createCommandPool(uint32_t queueFamilyIndex) const;
 
 		std::vector<vk::raii::CommandBuffer> allocateCommandBuffers(
 			vk::raii::CommandPool& commandPool,
-			size_t count
+			size_t count,
+			vk::CommandBufferLevel level
 		) const;
 
 		vk::raii::Fence createFence(bool preSignaled) const;
@@ -164,5 +271,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		vk::raii::Semaphore createSemaphore() const;
 
 		vma::Allocator createAllocator() const;
+
+		std::unique_ptr<FrameAllocator> createFrameAllocator() const;
 	};
 }
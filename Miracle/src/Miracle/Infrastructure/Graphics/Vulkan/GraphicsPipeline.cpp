@@ -2,69 +2,140 @@
 
 #include <exception>
 #include <array>
+#include <chrono>
+#include <vector>
 
 #include <format>
 
 #include <Miracle/Common/Models/Vertex.hpp>
 #include <Miracle/Application/Graphics/PushConstants.hpp>
+#include <Miracle/Application/Graphics/InstanceData.hpp>
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
 	GraphicsPipeline::GraphicsPipeline(
 		Application::ILogger& logger,
 		Application::IFileAccess& fileAccess,
 		GraphicsContext& context,
-		Swapchain& swapchain
+		ISwapchain& swapchain,
+		const Application::GraphicsPipelineInitProps& initProps
 	) :
 		m_logger(logger),
 		m_fileAccess(fileAccess),
 		m_context(context),
 		m_swapchain(swapchain)
 	{
-		auto vertexShaderBytecode = m_fileAccess.readFileAsBinary("Assets/Shaders/Default.vert.spv");
-		m_logger.info("Vulkan vertex shader loaded successfully");
+		bool isPrePass = initProps.depthMode == Application::GraphicsPipelineDepthMode::prePass;
 
-		auto fragmentShaderBytecode = m_fileAccess.readFileAsBinary("Assets/Shaders/Default.frag.spv");
-		m_logger.info("Vulkan fragment shader loaded successfully");
+		auto vertexShaderBytecode = m_fileAccess.readFileAsBinary(initProps.vertexShaderPath);
+		m_logger.info("Vulkan vertex shader loaded successfully");
 
 		auto vertexShaderModule = createShaderModule(vertexShaderBytecode);
-		auto fragmentShaderModule = createShaderModule(fragmentShaderBytecode);
+		vk::raii::ShaderModule fragmentShaderModule = nullptr;
+
+		// Both stages share the constants, as entries for constant IDs a shader does not declare are ignored
+		auto specializationMapEntries = std::vector<vk::SpecializationMapEntry>();
 
-		auto shaderStages = std::array{
+		for (uint32_t i = 0; i < initProps.specializationConstants.size(); i++) {
+			specializationMapEntries.push_back(
+				vk::SpecializationMapEntry{
+					.constantID = i,
+					.offset     = static_cast<uint32_t>(i * sizeof(uint32_t)),
+					.size       = sizeof(uint32_t)
+				}
+			);
+		}
+
+		auto specializationInfo = vk::SpecializationInfo{
+			.mapEntryCount = static_cast<uint32_t>(specializationMapEntries.size()),
+			.pMapEntries   = specializationMapEntries.data(),
+			.dataSize      = initProps.specializationConstants.size() * sizeof(uint32_t),
+			.pData         = initProps.specializationConstants.data()
+		};
+
+		auto shaderStages = std::vector{
 			vk::PipelineShaderStageCreateInfo{
 				.flags               = {},
 				.stage               = vk::ShaderStageFlagBits::eVertex,
 				.module              = *vertexShaderModule,
 				.pName               = "main",
-				.pSpecializationInfo = {}
-			},
-			vk::PipelineShaderStageCreateInfo{
-				.flags               = {},
-				.stage               = vk::ShaderStageFlagBits::eFragment,
-				.module              = *fragmentShaderModule,
-				.pName               = "main",
-				.pSpecializationInfo = {}
+				.pSpecializationInfo = &specializationInfo
 			}
 		};
 
-		auto vertexInputBindingDescription = vk::VertexInputBindingDescription{
-			.binding   = 0,
-			.stride    = sizeof(Vertex),
-			.inputRate = vk::VertexInputRate::eVertex
+		// Depth is all a pre-pass produces, so it runs without a fragment stage
+		if (!isPrePass) {
+			auto fragmentShaderBytecode = m_fileAccess.readFileAsBinary(initProps.fragmentShaderPath);
+			m_logger.info("Vulkan fragment shader loaded successfully");
+
+			fragmentShaderModule = createShaderModule(fragmentShaderBytecode);
+
+			shaderStages.push_back(
+				vk::PipelineShaderStageCreateInfo{
+					.flags               = {},
+					.stage               = vk::ShaderStageFlagBits::eFragment,
+					.module              = *fragmentShaderModule,
+					.pName               = "main",
+					.pSpecializationInfo = &specializationInfo
+				}
+			);
+		}
+
+		auto vertexInputBindingDescriptions = std::vector{
+			vk::VertexInputBindingDescription{
+				.binding   = 0,
+				.stride    = sizeof(Vertex),
+				.inputRate = vk::VertexInputRate::eVertex
+			}
 		};
 
-		auto vertexInputAttributeDescription = vk::VertexInputAttributeDescription{
-			.location = 0,
-			.binding  = 0,
-			.format   = vk::Format::eR32G32B32Sfloat,
-			.offset   = offsetof(Vertex, position)
+		auto vertexInputAttributeDescriptions = std::vector{
+			vk::VertexInputAttributeDescription{
+				.location = 0,
+				.binding  = 0,
+				.format   = vk::Format::eR32G32B32Sfloat,
+				.offset   = offsetof(Vertex, position)
+			}
 		};
 
+		if (initProps.useInstanceData) {
+			vertexInputBindingDescriptions.push_back(
+				vk::VertexInputBindingDescription{
+					.binding   = 1,
+					.stride    = sizeof(Application::InstanceData),
+					.inputRate = vk::VertexInputRate::eInstance
+				}
+			);
+
+			// Instance transform is passed row by row, as a matrix occupies one location per row
+			for (uint32_t row = 0; row < 4; row++) {
+				vertexInputAttributeDescriptions.push_back(
+					vk::VertexInputAttributeDescription{
+						.location = 1 + row,
+						.binding  = 1,
+						.format   = vk::Format::eR32G32B32A32Sfloat,
+						.offset   = static_cast<uint32_t>(
+							offsetof(Application::InstanceData, transform) + row * sizeof(Vector4)
+						)
+					}
+				);
+			}
+
+			vertexInputAttributeDescriptions.push_back(
+				vk::VertexInputAttributeDescription{
+					.location = 5,
+					.binding  = 1,
+					.format   = vk::Format::eR32G32B32Sfloat,
+					.offset   = offsetof(Application::InstanceData, color)
+				}
+			);
+		}
+
 		auto vertexInputStateCreateInfo = vk::PipelineVertexInputStateCreateInfo{
 			.flags                           = {},
-			.vertexBindingDescriptionCount   = 1,
-			.pVertexBindingDescriptions      = &vertexInputBindingDescription,
-			.vertexAttributeDescriptionCount = 1,
-			.pVertexAttributeDescriptions    = &vertexInputAttributeDescription
+			.vertexBindingDescriptionCount   = static_cast<uint32_t>(vertexInputBindingDescriptions.size()),
+			.pVertexBindingDescriptions      = vertexInputBindingDescriptions.data(),
+			.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexInputAttributeDescriptions.size()),
+			.pVertexAttributeDescriptions    = vertexInputAttributeDescriptions.data()
 		};
 
 		auto inputAssemblyStateCreateInfo = vk::PipelineInputAssemblyStateCreateInfo{
@@ -86,8 +157,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			.depthClampEnable        = false,
 			.rasterizerDiscardEnable = false,
 			.polygonMode             = vk::PolygonMode::eFill,
-			.cullMode                = vk::CullModeFlagBits::eNone,
-			.frontFace               = {},
+			.cullMode                = toCullModeFlags(initProps.cullMode),
+			.frontFace               = vk::FrontFace::eCounterClockwise,
 			.depthBiasEnable         = false,
 			.depthBiasConstantFactor = {},
 			.depthBiasClamp          = {},
@@ -105,18 +176,37 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			.alphaToOneEnable      = {}
 		};
 
+		bool isAdditive = initProps.blendMode == BlendMode::additive;
+
 		auto colorBlendAttachmentState = vk::PipelineColorBlendAttachmentState{
-			.blendEnable         = false,
-			.srcColorBlendFactor = {},
-			.dstColorBlendFactor = {},
-			.colorBlendOp        = {},
-			.srcAlphaBlendFactor = {},
-			.dstAlphaBlendFactor = {},
-			.alphaBlendOp        = {},
-			.colorWriteMask      = vk::ColorComponentFlagBits::eR
-				| vk::ColorComponentFlagBits::eG
-				| vk::ColorComponentFlagBits::eB
-				| vk::ColorComponentFlagBits::eA
+			.blendEnable         = isAdditive,
+			.srcColorBlendFactor = vk::BlendFactor::eOne,
+			.dstColorBlendFactor = isAdditive ? vk::BlendFactor::eOne : vk::BlendFactor::eZero,
+			.colorBlendOp        = vk::BlendOp::eAdd,
+			.srcAlphaBlendFactor = vk::BlendFactor::eOne,
+			.dstAlphaBlendFactor = vk::BlendFactor::eZero,
+			.alphaBlendOp        = vk::BlendOp::eAdd,
+			.colorWriteMask      = isPrePass
+				? vk::ColorComponentFlags()
+				: vk::ColorComponentFlagBits::eR
+					| vk::ColorComponentFlagBits::eG
+					| vk::ColorComponentFlagBits::eB
+					| vk::ColorComponentFlagBits::eA
+		};
+
+		// Equal depths pass, so fragments written by a pre-pass are shaded and coplanar draws keep their draw order
+		auto depthStencilStateCreateInfo = vk::PipelineDepthStencilStateCreateInfo{
+			.flags                 = {},
+			.depthTestEnable       = initProps.depthMode != Application::GraphicsPipelineDepthMode::disabled,
+			.depthWriteEnable      = initProps.depthMode == Application::GraphicsPipelineDepthMode::readWrite
+				|| initProps.depthMode == Application::GraphicsPipelineDepthMode::prePass,
+			.depthCompareOp        = vk::CompareOp::eLessOrEqual,
+			.depthBoundsTestEnable = false,
+			.stencilTestEnable     = false,
+			.front                 = {},
+			.back                  = {},
+			.minDepthBounds        = 0.0f,
+			.maxDepthBounds        = 1.0f
 		};
 
 		auto colorBlendStateCreateInfo = vk::PipelineColorBlendStateCreateInfo{
@@ -168,9 +258,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			throw Application::GraphicsPipelineErrors::CreationError();
 		}
 
+		auto creationStartTime = std::chrono::steady_clock::now();
+
 		try {
 			m_pipeline = m_context.getDevice().createGraphicsPipeline(
-				nullptr,
+				m_context.getPipelineCache(),
 				vk::GraphicsPipelineCreateInfo{
 					.flags               = {},
 					.stageCount          = static_cast<uint32_t>(shaderStages.size()),
@@ -181,7 +273,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 					.pViewportState      = &viewportStateCreateInfo,
 					.pRasterizationState = &rasterizationStateCreateInfo,
 					.pMultisampleState   = &multisampleStateCreateInfo,
-					.pDepthStencilState  = nullptr,
+					.pDepthStencilState  = &depthStencilStateCreateInfo,
 					.pColorBlendState    = &colorBlendStateCreateInfo,
 					.pDynamicState       = &dynamicStateCreateInfo,
 					.layout              = *m_layout,
@@ -197,7 +289,17 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			throw Application::GraphicsPipelineErrors::CreationError();
 		}
 
-		m_logger.info("Vulkan graphics pipeline created");
+		auto creationDuration = std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - creationStartTime
+		);
+
+		m_logger.info(
+			std::format(
+				"Vulkan graphics pipeline created in {:.2f} ms with {} pipeline cache",
+				creationDuration.count(),
+				m_context.isPipelineCacheLoaded() ? "a loaded" : "an empty"
+			)
+		);
 	}
 
 	GraphicsPipeline::~GraphicsPipeline() {
@@ -224,6 +326,19 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		);
 	}
 
+	vk::CullModeFlags GraphicsPipeline::toCullModeFlags(CullMode cullMode) {
+		switch (cullMode) {
+		case CullMode::back:
+			return vk::CullModeFlagBits::eBack;
+
+		case CullMode::front:
+			return vk::CullModeFlagBits::eFront;
+
+		default:
+			return vk::CullModeFlagBits::eNone;
+		}
+	}
+
 	vk::raii::ShaderModule GraphicsPipeline::createShaderModule(const std::vector<std::byte>& bytecode) const {
 		try {
 			return m_context.getDevice().createShaderModule(
@@ -8,7 +8,7 @@
 #include <Miracle/Application/IFileAccess.hpp>
 #include "Vulkan.hpp"
 #include "GraphicsContext.hpp"
-#include "Swapchain.hpp"
+#include "ISwapchain.hpp"
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
 	class GraphicsPipeline : public Application::IGraphicsPipeline {
@@ -16,7 +16,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		Application::ILogger& m_logger;
 		Application::IFileAccess& m_fileAccess;
 		GraphicsContext& m_context;
-		Swapchain& m_swapchain;
+		ISwapchain& m_swapchain;
 
 		vk::raii::PipelineLayout m_layout = nullptr;
 		vk::raii::Pipeline m_pipeline = nullptr;
@@ -26,7 +26,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			Application::ILogger& logger,
 			Application::IFileAccess& fileAccess,
 			GraphicsContext& context,
-			Swapchain& swapchain
+			ISwapchain& swapchain,
+			const Application::GraphicsPipelineInitProps& initProps
 		);
 
 		~GraphicsPipeline();
@@ -36,6 +37,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		virtual void pushConstants(const Application::PushConstants& constants) override;
 
 	private:
+		static vk::CullModeFlags toCullModeFlags(CullMode cullMode);
+
 		vk::raii::ShaderModule createShaderModule(const std::vector<std::byte>& bytecode) const;
 	};
 }
@@ -0,0 +1,16 @@
+#include "HeadlessTarget.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	HeadlessTarget::HeadlessTarget(uint32_t width, uint32_t height) :
+		m_extent(
+			vk::Extent2D{
+				.width  = width,
+				.height = height
+			}
+		)
+	{}
+
+	vk::raii::SurfaceKHR HeadlessTarget::createVulkanSurface(vk::raii::Instance&) const {
+		return nullptr;
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <span>
+
+#include "Vulkan.hpp"
+#include "IContextTarget.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	// Context target without a surface, for rendering on machines without a display
+	class HeadlessTarget : public IContextTarget {
+	private:
+		vk::Extent2D m_extent;
+
+	public:
+		HeadlessTarget(uint32_t width, uint32_t height);
+
+		virtual bool isSizeChanged() override { return false; }
+
+		virtual bool isCurrentlyPresentable() const override { return true; }
+
+		virtual bool isHeadless() const override { return true; }
+
+		virtual std::span<const char*> getRequiredVulkanExtensionNames() const override { return {}; }
+
+		virtual vk::raii::SurfaceKHR createVulkanSurface(
+			vk::raii::Instance& instance
+		) const override;
+
+		virtual vk::Extent2D getCurrentVulkanExtent() const override { return m_extent; }
+	};
+}
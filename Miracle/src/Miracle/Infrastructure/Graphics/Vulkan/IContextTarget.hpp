@@ -10,6 +10,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	public:
 		virtual ~IContextTarget() = default;
 
+		virtual bool isHeadless() const = 0;
+
 		virtual std::span<const char*> getRequiredVulkanExtensionNames() const = 0;
 
 		virtual vk::raii::SurfaceKHR createVulkanSurface(
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Miracle/Application/Graphics/ISwapchain.hpp>
+#include "Vulkan.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	class ISwapchain : public Application::ISwapchain {
+	public:
+		virtual ~ISwapchain() = default;
+
+		virtual const vk::raii::RenderPass& getRenderPass() const = 0;
+	};
+}
@@ -9,39 +9,17 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	IndexBuffer::IndexBuffer(
 		Application::ILogger& logger,
 		GraphicsContext& context,
-		const std::vector<Face>& faces
+		uint32_t faceCapacity
 	) :
 		m_logger(logger),
 		m_context(context)
 	{
-		if (faces.empty()) {
-			m_logger.error("No indices provided for Vulkan index buffer creation");
+		if (faceCapacity == 0) {
+			m_logger.error("No face capacity provided for Vulkan index buffer creation");
 			throw Application::IndexBufferErrors::NoIndicesProvidedError();
 		}
 
-		auto requiredBufferSize = static_cast<vk::DeviceSize>(sizeof(faces.front()) * faces.size());
-
-		auto [stagingBuffer, stagingAllocation] = std::pair<vk::Buffer, vma::Allocation>();
-
-		try {
-			auto [buffer, allocation] = BufferUtilities::createStagingBuffer(
-				m_context,
-				requiredBufferSize
-			);
-
-			stagingBuffer = buffer;
-			stagingAllocation = allocation;
-		}
-		catch (const std::exception& e) {
-			m_logger.error(
-				std::format("Failed to create staging buffer for Vulkan index buffer.\n{}", e.what())
-			);
-
-			throw Application::IndexBufferErrors::CreationError();
-		}
-
-		auto stagingBufferData = m_context.getAllocator().getAllocationInfo(stagingAllocation).pMappedData;
-		std::memcpy(stagingBufferData, faces.data(), requiredBufferSize);
+		auto requiredBufferSize = static_cast<vk::DeviceSize>(sizeof(Face) * faceCapacity);
 
 		try {
 			auto [buffer, allocation] = BufferUtilities::createBuffer(
@@ -58,15 +36,10 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 				std::format("Failed to create Vulkan index buffer.\n{}", e.what())
 			);
 
-			m_context.getAllocator().destroyBuffer(stagingBuffer, stagingAllocation);
 			throw Application::IndexBufferErrors::CreationError();
 		}
 
-		BufferUtilities::copyBuffer(m_context, m_buffer, stagingBuffer, requiredBufferSize);
-
-		m_context.getAllocator().destroyBuffer(stagingBuffer, stagingAllocation);
-
-		m_indexCount = faces.front().indices.size() * faces.size();
+		m_faceCapacity = faceCapacity;
 
 		m_logger.info("Vulkan index buffer created");
 	}
@@ -77,6 +50,17 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		m_context.getAllocator().destroyBuffer(m_buffer, m_allocation);
 	}
 
+	void IndexBuffer::write(uint32_t firstFace, std::span<const Face> faces) {
+		m_context.getUploadBatcher().enqueueBufferUpload(
+			m_buffer,
+			static_cast<vk::DeviceSize>(sizeof(Face) * firstFace),
+			faces.data(),
+			static_cast<vk::DeviceSize>(faces.size_bytes()),
+			vk::PipelineStageFlagBits::eVertexInput,
+			vk::AccessFlagBits::eIndexRead
+		);
+	}
+
 	void IndexBuffer::bind() {
 		m_context.getGraphicsCommandBuffer().bindIndexBuffer(m_buffer, 0, vk::IndexType::eUint32);
 	}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include <Miracle/Common/Models/Face.hpp>
 #include <Miracle/Application/ILogger.hpp>
@@ -17,18 +17,20 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		vk::Buffer m_buffer = nullptr;
 		vma::Allocation m_allocation = nullptr;
-		uint32_t m_indexCount = 0;
+		uint32_t m_faceCapacity = 0;
 
 	public:
 		IndexBuffer(
 			Application::ILogger& logger,
 			GraphicsContext& context,
-			const std::vector<Face>& faces
+			uint32_t faceCapacity
 		);
 
 		~IndexBuffer();
 
-		virtual uint32_t getIndexCount() const override { return m_indexCount; }
+		virtual uint32_t getFaceCapacity() const override { return m_faceCapacity; }
+
+		virtual void write(uint32_t firstFace, std::span<const Face> faces) override;
 
 		virtual void bind() override;
 	};
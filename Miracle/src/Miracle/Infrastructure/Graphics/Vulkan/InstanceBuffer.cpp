@@ -0,0 +1,44 @@
+#include "InstanceBuffer.hpp"
+
+#include <cstddef>
+#include <cstring>
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	InstanceBuffer::InstanceBuffer(
+		Application::ILogger& logger,
+		GraphicsContext& context
+	) :
+		m_logger(logger),
+		m_context(context)
+	{
+		m_logger.info("Vulkan instance buffer created");
+	}
+
+	InstanceBuffer::~InstanceBuffer() {
+		m_logger.info("Destroying Vulkan instance buffer...");
+	}
+
+	void InstanceBuffer::reserve(uint32_t instanceCount) {
+		m_allocation = m_context.getFrameAllocator().allocate(
+			static_cast<vk::DeviceSize>(instanceCount) * sizeof(Application::InstanceData)
+		);
+
+		m_instanceCapacity = instanceCount;
+	}
+
+	void InstanceBuffer::write(uint32_t firstInstance, std::span<const Application::InstanceData> instances) {
+		auto offset = static_cast<vk::DeviceSize>(firstInstance) * sizeof(Application::InstanceData);
+
+		std::memcpy(
+			static_cast<std::byte*>(m_allocation.mappedData) + offset,
+			instances.data(),
+			instances.size_bytes()
+		);
+
+		m_context.getFrameAllocator().flush(m_allocation, offset, instances.size_bytes());
+	}
+
+	void InstanceBuffer::bind() {
+		m_context.getGraphicsCommandBuffer().bindVertexBuffers(1, m_allocation.buffer, m_allocation.offset);
+	}
+}
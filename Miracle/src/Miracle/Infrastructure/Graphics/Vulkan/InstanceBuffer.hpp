@@ -0,0 +1,36 @@
+#pragma once
+
+#include <span>
+
+#include <Miracle/Application/ILogger.hpp>
+#include <Miracle/Application/Graphics/IInstanceBuffer.hpp>
+#include "Vulkan.hpp"
+#include "GraphicsContext.hpp"
+#include "FrameAllocator.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	class InstanceBuffer : public Application::IInstanceBuffer {
+	private:
+		Application::ILogger& m_logger;
+		GraphicsContext& m_context;
+
+		FrameAllocation m_allocation = {};
+		uint32_t m_instanceCapacity = 0;
+
+	public:
+		InstanceBuffer(
+			Application::ILogger& logger,
+			GraphicsContext& context
+		);
+
+		~InstanceBuffer();
+
+		virtual uint32_t getInstanceCapacity() const override { return m_instanceCapacity; }
+
+		virtual void reserve(uint32_t instanceCount) override;
+
+		virtual void write(uint32_t firstInstance, std::span<const Application::InstanceData> instances) override;
+
+		virtual void bind() override;
+	};
+}
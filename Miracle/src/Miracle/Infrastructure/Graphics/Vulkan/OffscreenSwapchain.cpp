@@ -0,0 +1,496 @@
+#include "OffscreenSwapchain.hpp"
+
+#include <array>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <limits>
+
+#include <Miracle/Application/Tracer.hpp>
+#include "BufferUtilities.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	OffscreenSwapchain::OffscreenSwapchain(
+		Application::ILogger& logger,
+		GraphicsContext& context,
+		const Application::SwapchainInitProps& initProps
+	) :
+		m_logger(logger),
+		m_context(context),
+		m_useVsync(initProps.useVsync),
+		m_useTripleBuffering(initProps.useTripleBuffering),
+		m_imageExtent(context.getTarget().getCurrentVulkanExtent()),
+		m_depthBuffer(logger, context)
+	{
+		m_renderPass = createRenderPass();
+
+		createImages();
+		createReadbackObjects();
+
+		m_imageIndex = static_cast<uint32_t>(m_context.getCurrentGraphicsCommandBufferIndex());
+
+		m_logger.info(
+			std::format(
+				"Vulkan offscreen swapchain created with {} images of {}x{}",
+				m_images.size(),
+				m_imageExtent.width,
+				m_imageExtent.height
+			)
+		);
+	}
+
+	OffscreenSwapchain::~OffscreenSwapchain() {
+		m_logger.info("Destroying Vulkan offscreen swapchain...");
+
+		destroyImages();
+	}
+
+	Application::SwapchainImageSize OffscreenSwapchain::getImageSize() const {
+		return Application::SwapchainImageSize{
+			.width  = m_imageExtent.width,
+			.height = m_imageExtent.height
+		};
+	}
+
+	void OffscreenSwapchain::beginRenderPass(ColorRgb clearColor, bool useSecondaryCommands) {
+		auto clearValues = std::array{
+			vk::ClearValue(
+				vk::ClearColorValue(
+					std::array{
+						clearColor.redChannel,
+						clearColor.greenChannel,
+						clearColor.blueChannel,
+						1.0f
+					}
+				)
+			),
+			vk::ClearValue(
+				vk::ClearDepthStencilValue{
+					.depth   = 1.0f,
+					.stencil = 0
+				}
+			)
+		};
+
+		auto& frameBuffer = m_images[m_imageIndex].frameBuffer;
+
+		m_context.getGraphicsCommandBuffer().beginRenderPass(
+			vk::RenderPassBeginInfo{
+				.renderPass      = *m_renderPass,
+				.framebuffer     = *frameBuffer,
+				.renderArea      = vk::Rect2D{
+					.offset = vk::Offset2D{
+						.x = 0,
+						.y = 0
+					},
+					.extent = m_imageExtent
+				},
+				.clearValueCount = static_cast<uint32_t>(clearValues.size()),
+				.pClearValues    = clearValues.data()
+			},
+			useSecondaryCommands
+				? vk::SubpassContents::eSecondaryCommandBuffers
+				: vk::SubpassContents::eInline
+		);
+
+		m_context.setCurrentRenderPass(*m_renderPass, *frameBuffer);
+	}
+
+	void OffscreenSwapchain::endRenderPass() {
+		m_context.getGraphicsCommandBuffer().endRenderPass();
+	}
+
+	void OffscreenSwapchain::swap() {
+		MIRACLE_TRACE_ZONE("OffscreenSwapchain::swap");
+
+		m_lastImageIndex = m_imageIndex;
+		m_hasSwappedImage = true;
+
+		m_context.nextGraphicsCommandBuffer();
+
+		// Images are tied to frame slots, so an image is free again once its slot's fence has been waited on
+		m_imageIndex = static_cast<uint32_t>(m_context.getCurrentGraphicsCommandBufferIndex());
+	}
+
+	void OffscreenSwapchain::recreate() {
+		destroyImages();
+
+		m_imageExtent = m_context.getTarget().getCurrentVulkanExtent();
+		m_hasSwappedImage = false;
+
+		createImages();
+
+		m_logger.info(
+			std::format(
+				"Vulkan offscreen swapchain re-created with {} images of {}x{}",
+				m_images.size(),
+				m_imageExtent.width,
+				m_imageExtent.height
+			)
+		);
+	}
+
+	Application::FrameImage OffscreenSwapchain::readLastImage() {
+		if (!m_hasSwappedImage) {
+			m_logger.error("No image has been swapped in Vulkan offscreen swapchain yet");
+			throw Application::SwapchainErrors::ReadbackError();
+		}
+
+		m_context.waitForDeviceIdle();
+
+		auto imageSize = static_cast<vk::DeviceSize>(m_imageExtent.width)
+			* m_imageExtent.height
+			* s_bytesPerPixel;
+
+		auto& allocator = m_context.getAllocator();
+		vk::Buffer readbackBuffer = nullptr;
+		vma::Allocation readbackAllocation = nullptr;
+
+		try {
+			auto [buffer, allocation] = BufferUtilities::createReadbackBuffer(m_context, imageSize);
+
+			readbackBuffer = buffer;
+			readbackAllocation = allocation;
+
+			m_readbackCommandBuffer.reset();
+			m_readbackCommandBuffer.begin(
+				vk::CommandBufferBeginInfo{
+					.flags            = vk::CommandBufferUsageFlagBits::eOneTimeSubmit,
+					.pInheritanceInfo = nullptr
+				}
+			);
+
+			recordImageCopy(m_images[m_lastImageIndex].image, readbackBuffer);
+
+			m_readbackCommandBuffer.end();
+
+			m_context.getDevice().resetFences(*m_readbackCompletedFence);
+
+			m_context.getGraphicsQueue().submit(
+				vk::SubmitInfo{
+					.waitSemaphoreCount   = 0,
+					.pWaitSemaphores      = nullptr,
+					.pWaitDstStageMask    = {},
+					.commandBufferCount   = 1,
+					.pCommandBuffers      = &*m_readbackCommandBuffer,
+					.signalSemaphoreCount = 0,
+					.pSignalSemaphores    = nullptr
+				},
+				*m_readbackCompletedFence
+			);
+
+			auto result = m_context.getDevice().waitForFences(
+				*m_readbackCompletedFence,
+				true,
+				std::numeric_limits<uint64_t>::max()
+			);
+
+			if (result == vk::Result::eTimeout) [[unlikely]] {
+				m_logger.warning("Timed out on waiting for Vulkan fence");
+			}
+
+			allocator.invalidateAllocation(readbackAllocation, 0, imageSize);
+		}
+		catch (const std::exception& e) {
+			if (readbackBuffer) allocator.destroyBuffer(readbackBuffer, readbackAllocation);
+
+			m_logger.error(
+				std::format("Failed to read back image from Vulkan offscreen swapchain.\n{}", e.what())
+			);
+
+			throw Application::SwapchainErrors::ReadbackError();
+		}
+
+		auto frameImage = Application::FrameImage{
+			.width  = m_imageExtent.width,
+			.height = m_imageExtent.height,
+			.pixels = std::vector<std::byte>(static_cast<size_t>(imageSize))
+		};
+
+		std::memcpy(
+			frameImage.pixels.data(),
+			allocator.getAllocationInfo(readbackAllocation).pMappedData,
+			frameImage.pixels.size()
+		);
+
+		allocator.destroyBuffer(readbackBuffer, readbackAllocation);
+
+		return frameImage;
+	}
+
+	void OffscreenSwapchain::createImages() {
+		auto imageCount = m_context.getFramesInFlight();
+
+		m_images.reserve(imageCount);
+
+		m_depthBuffer.create(m_imageExtent);
+
+		try {
+			for (size_t i = 0; i < imageCount; i++) {
+				auto& offscreenImage = m_images.emplace_back();
+
+				auto [image, allocation] = m_context.getAllocator().createImage(
+					vk::ImageCreateInfo{
+						.flags                 = {},
+						.imageType             = vk::ImageType::e2D,
+						.format                = s_imageFormat,
+						.extent                = vk::Extent3D{
+							.width  = m_imageExtent.width,
+							.height = m_imageExtent.height,
+							.depth  = 1
+						},
+						.mipLevels             = 1,
+						.arrayLayers           = 1,
+						.samples               = vk::SampleCountFlagBits::e1,
+						.tiling                = vk::ImageTiling::eOptimal,
+						.usage                 = vk::ImageUsageFlagBits::eColorAttachment
+							| vk::ImageUsageFlagBits::eTransferSrc,
+						.sharingMode           = vk::SharingMode::eExclusive,
+						.queueFamilyIndexCount = 0,
+						.pQueueFamilyIndices   = nullptr,
+						.initialLayout         = vk::ImageLayout::eUndefined
+					},
+					vma::AllocationCreateInfo{
+						.flags          = {},
+						.usage          = vma::MemoryUsage::eAutoPreferDevice,
+						.requiredFlags  = {},
+						.preferredFlags = {},
+						.memoryTypeBits = {},
+						.pool           = nullptr,
+						.pUserData      = nullptr,
+						.priority       = 1.0f
+					}
+				);
+
+				offscreenImage.image = image;
+				offscreenImage.allocation = allocation;
+
+				offscreenImage.imageView = m_context.getDevice().createImageView(
+					vk::ImageViewCreateInfo{
+						.flags            = {},
+						.image            = image,
+						.viewType         = vk::ImageViewType::e2D,
+						.format           = s_imageFormat,
+						.components       = vk::ComponentMapping{
+							.r = vk::ComponentSwizzle::eIdentity,
+							.g = vk::ComponentSwizzle::eIdentity,
+							.b = vk::ComponentSwizzle::eIdentity,
+							.a = vk::ComponentSwizzle::eIdentity
+						},
+						.subresourceRange = vk::ImageSubresourceRange{
+							.aspectMask     = vk::ImageAspectFlagBits::eColor,
+							.baseMipLevel   = 0,
+							.levelCount     = 1,
+							.baseArrayLayer = 0,
+							.layerCount     = 1
+						}
+					}
+				);
+
+				auto attachments = std::array{
+					*offscreenImage.imageView,
+					*m_depthBuffer.getImageView()
+				};
+
+				offscreenImage.frameBuffer = m_context.getDevice().createFramebuffer(
+					vk::FramebufferCreateInfo{
+						.flags           = {},
+						.renderPass      = *m_renderPass,
+						.attachmentCount = static_cast<uint32_t>(attachments.size()),
+						.pAttachments    = attachments.data(),
+						.width           = m_imageExtent.width,
+						.height          = m_imageExtent.height,
+						.layers          = 1
+					}
+				);
+			}
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create images for Vulkan offscreen swapchain.\n{}", e.what())
+			);
+
+			throw Application::SwapchainErrors::CreationError();
+		}
+	}
+
+	void OffscreenSwapchain::destroyImages() {
+		for (auto& offscreenImage : m_images) {
+			offscreenImage.frameBuffer.clear();
+			offscreenImage.imageView.clear();
+
+			if (offscreenImage.image) {
+				m_context.getAllocator().destroyImage(offscreenImage.image, offscreenImage.allocation);
+			}
+		}
+
+		m_images.clear();
+
+		m_depthBuffer.destroy();
+	}
+
+	vk::raii::RenderPass OffscreenSwapchain::createRenderPass() const {
+		auto attachments = std::array{
+			vk::AttachmentDescription{
+				.flags          = {},
+				.format         = s_imageFormat,
+				.samples        = vk::SampleCountFlagBits::e1,
+				.loadOp         = vk::AttachmentLoadOp::eClear,
+				.storeOp        = vk::AttachmentStoreOp::eStore,
+				.stencilLoadOp  = vk::AttachmentLoadOp::eDontCare,
+				.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
+				.initialLayout  = vk::ImageLayout::eUndefined,
+				.finalLayout    = vk::ImageLayout::eTransferSrcOptimal
+			},
+			m_depthBuffer.getAttachmentDescription()
+		};
+
+		auto attachmentReferences = std::array{
+			vk::AttachmentReference{
+				.attachment = 0,
+				.layout     = vk::ImageLayout::eColorAttachmentOptimal
+			}
+		};
+
+		auto depthAttachmentReference = vk::AttachmentReference{
+			.attachment = 1,
+			.layout     = vk::ImageLayout::eDepthStencilAttachmentOptimal
+		};
+
+		auto subpasses = std::array{
+			vk::SubpassDescription{
+				.flags                   = {},
+				.pipelineBindPoint       = vk::PipelineBindPoint::eGraphics,
+				.inputAttachmentCount    = 0,
+				.pInputAttachments       = nullptr,
+				.colorAttachmentCount    = static_cast<uint32_t>(attachmentReferences.size()),
+				.pColorAttachments       = attachmentReferences.data(),
+				.pResolveAttachments     = nullptr,
+				.pDepthStencilAttachment = &depthAttachmentReference,
+				.preserveAttachmentCount = 0,
+				.pPreserveAttachments    = nullptr
+			}
+		};
+
+		auto subpassDependencies = std::array{
+			vk::SubpassDependency{
+				.srcSubpass      = VK_SUBPASS_EXTERNAL,
+				.dstSubpass      = 0,
+				.srcStageMask    = vk::PipelineStageFlagBits::eTransfer
+					| vk::PipelineStageFlagBits::eLateFragmentTests,
+				.dstStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput
+					| vk::PipelineStageFlagBits::eEarlyFragmentTests,
+				.srcAccessMask   = vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+				.dstAccessMask   = vk::AccessFlagBits::eColorAttachmentWrite
+					| vk::AccessFlagBits::eDepthStencilAttachmentRead
+					| vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+				.dependencyFlags = {}
+			},
+			vk::SubpassDependency{
+				.srcSubpass      = 0,
+				.dstSubpass      = VK_SUBPASS_EXTERNAL,
+				.srcStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+				.dstStageMask    = vk::PipelineStageFlagBits::eTransfer,
+				.srcAccessMask   = vk::AccessFlagBits::eColorAttachmentWrite,
+				.dstAccessMask   = vk::AccessFlagBits::eTransferRead,
+				.dependencyFlags = {}
+			}
+		};
+
+		try {
+			return m_context.getDevice().createRenderPass(
+				vk::RenderPassCreateInfo{
+					.flags           = {},
+					.attachmentCount = static_cast<uint32_t>(attachments.size()),
+					.pAttachments    = attachments.data(),
+					.subpassCount    = static_cast<uint32_t>(subpasses.size()),
+					.pSubpasses      = subpasses.data(),
+					.dependencyCount = static_cast<uint32_t>(subpassDependencies.size()),
+					.pDependencies   = subpassDependencies.data()
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create Vulkan render pass for offscreen swapchain.\n{}", e.what())
+			);
+
+			throw Application::SwapchainErrors::CreationError();
+		}
+	}
+
+	void OffscreenSwapchain::createReadbackObjects() {
+		try {
+			m_readbackCommandPool = m_context.getDevice().createCommandPool(
+				vk::CommandPoolCreateInfo{
+					.flags            = vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+					.queueFamilyIndex = m_context.getDeviceInfo().queueFamilyIndices.graphicsFamilyIndex.value()
+				}
+			);
+
+			m_readbackCommandBuffer = std::move(
+				m_context.getDevice().allocateCommandBuffers(
+					vk::CommandBufferAllocateInfo{
+						.commandPool        = *m_readbackCommandPool,
+						.level              = vk::CommandBufferLevel::ePrimary,
+						.commandBufferCount = 1
+					}
+				).front()
+			);
+
+			m_readbackCompletedFence = m_context.getDevice().createFence(
+				vk::FenceCreateInfo{
+					.flags = {}
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create readback objects for Vulkan offscreen swapchain.\n{}", e.what())
+			);
+
+			throw Application::SwapchainErrors::CreationError();
+		}
+	}
+
+	void OffscreenSwapchain::recordImageCopy(vk::Image image, vk::Buffer buffer) const {
+		m_readbackCommandBuffer.copyImageToBuffer(
+			image,
+			vk::ImageLayout::eTransferSrcOptimal,
+			buffer,
+			vk::BufferImageCopy{
+				.bufferOffset      = 0,
+				.bufferRowLength   = 0,
+				.bufferImageHeight = 0,
+				.imageSubresource  = vk::ImageSubresourceLayers{
+					.aspectMask     = vk::ImageAspectFlagBits::eColor,
+					.mipLevel       = 0,
+					.baseArrayLayer = 0,
+					.layerCount     = 1
+				},
+				.imageOffset       = vk::Offset3D{
+					.x = 0,
+					.y = 0,
+					.z = 0
+				},
+				.imageExtent       = vk::Extent3D{
+					.width  = m_imageExtent.width,
+					.height = m_imageExtent.height,
+					.depth  = 1
+				}
+			}
+		);
+
+		m_readbackCommandBuffer.pipelineBarrier(
+			vk::PipelineStageFlagBits::eTransfer,
+			vk::PipelineStageFlagBits::eHost,
+			{},
+			vk::MemoryBarrier{
+				.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask = vk::AccessFlagBits::eHostRead
+			},
+			nullptr,
+			nullptr
+		);
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+
+#include <Miracle/Application/ILogger.hpp>
+#include "Vulkan.hpp"
+#include "Vma.hpp"
+#include "ISwapchain.hpp"
+#include "GraphicsContext.hpp"
+#include "DepthBuffer.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	// Renders into device local images instead of a surface, one image per frame in flight
+	class OffscreenSwapchain : public ISwapchain {
+	private:
+		struct OffscreenImage {
+			vk::Image image = nullptr;
+			vma::Allocation allocation = nullptr;
+			vk::raii::ImageView imageView = nullptr;
+			vk::raii::Framebuffer frameBuffer = nullptr;
+		};
+
+		static constexpr auto s_imageFormat = vk::Format::eR8G8B8A8Srgb;
+		static constexpr uint32_t s_bytesPerPixel = 4;
+
+		Application::ILogger& m_logger;
+		GraphicsContext& m_context;
+
+		bool m_useVsync;
+		bool m_useTripleBuffering;
+		vk::Extent2D m_imageExtent;
+		vk::raii::RenderPass m_renderPass = nullptr;
+		std::vector<OffscreenImage> m_images;
+		DepthBuffer m_depthBuffer;
+		uint32_t m_imageIndex = 0;
+		uint32_t m_lastImageIndex = 0;
+		bool m_hasSwappedImage = false;
+
+		vk::raii::CommandPool m_readbackCommandPool = nullptr;
+		vk::raii::CommandBuffer m_readbackCommandBuffer = nullptr;
+		vk::raii::Fence m_readbackCompletedFence = nullptr;
+
+	public:
+		OffscreenSwapchain(
+			Application::ILogger& logger,
+			GraphicsContext& context,
+			const Application::SwapchainInitProps& initProps
+		);
+
+		~OffscreenSwapchain();
+
+		virtual Application::SwapchainImageSize getImageSize() const override;
+
+		virtual void beginRenderPass(ColorRgb clearColor, bool useSecondaryCommands) override;
+
+		virtual void endRenderPass() override;
+
+		virtual void swap() override;
+
+		virtual void recreate() override;
+
+		virtual Application::FrameImage readLastImage() override;
+
+		// Nothing is presented, so vsync and triple buffering are only remembered
+		virtual bool isUsingVsync() const override { return m_useVsync; }
+
+		virtual void setVsync(bool useVsync) override { m_useVsync = useVsync; }
+
+		virtual bool isUsingTripleBuffering() const override { return m_useTripleBuffering; }
+
+		virtual void setTripleBuffering(bool useTripleBuffering) override {
+			m_useTripleBuffering = useTripleBuffering;
+		}
+
+		virtual const vk::raii::RenderPass& getRenderPass() const override { return m_renderPass; }
+
+	private:
+		void createImages();
+
+		void destroyImages();
+
+		vk::raii::RenderPass createRenderPass() const;
+
+		void createReadbackObjects();
+
+		void recordImageCopy(vk::Image image, vk::Buffer buffer) const;
+	};
+}
@@ -6,6 +6,8 @@
 #include <array>
 #include <format>
 
+#include <Miracle/Application/Tracer.hpp>
+
 namespace Miracle::Infrastructure::Graphics::Vulkan {
 	Swapchain::Swapchain(
 		Application::ILogger& logger,
@@ -18,7 +20,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		m_surfaceFormat(selectSurfaceFormat()),
 		m_imageExtent(selectExtent()),
 		m_presentMode(selectPresentMode(initProps.useVsync)),
-		m_swapchain(createSwapchain())
+		m_swapchain(createSwapchain()),
+		m_depthBuffer(logger, context)
 	{
 		auto images = m_swapchain.getImages();
 
@@ -28,6 +31,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			m_images.emplace_back(image, createImageView(image));
 		}
 
+		m_depthBuffer.create(m_imageExtent);
+
 		m_renderPass = createRenderPass();
 
 		m_frameBuffers.reserve(m_images.size());
@@ -58,7 +63,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		};
 	}
 
-	void Swapchain::beginRenderPass(ColorRgb clearColor) {
+	void Swapchain::beginRenderPass(ColorRgb clearColor, bool useSecondaryCommands) {
 		auto clearValues = std::array{
 			vk::ClearValue(
 				vk::ClearColorValue(
@@ -69,6 +74,12 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 						1.0f
 					}
 				)
+			),
+			vk::ClearValue(
+				vk::ClearDepthStencilValue{
+					.depth   = 1.0f,
+					.stencil = 0
+				}
 			)
 		};
 
@@ -86,8 +97,12 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 				.clearValueCount = static_cast<uint32_t>(clearValues.size()),
 				.pClearValues    = clearValues.data()
 			},
-			vk::SubpassContents::eInline
+			useSecondaryCommands
+				? vk::SubpassContents::eSecondaryCommandBuffers
+				: vk::SubpassContents::eInline
 		);
+
+		m_context.setCurrentRenderPass(*m_renderPass, *m_frameBuffers[m_imageIndex]);
 	}
 
 	void Swapchain::endRenderPass() {
@@ -95,6 +110,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	}
 
 	void Swapchain::swap() {
+		MIRACLE_TRACE_ZONE("Swapchain::swap");
+
 		auto result = m_context.getPresentQueue().presentKHR(
 			vk::PresentInfoKHR{
 				.waitSemaphoreCount = 1,
@@ -117,12 +134,15 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 	void Swapchain::recreate() {
 		m_frameBuffers.clear();
+		m_depthBuffer.destroy();
 		m_images.clear();
 		m_swapchain.clear();
 
 		m_imageExtent = selectExtent();
 		m_swapchain = createSwapchain();
 
+		m_depthBuffer.create(m_imageExtent);
+
 		auto images = m_swapchain.getImages();
 
 		for (auto& image : images) {
@@ -146,6 +166,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		);
 	}
 
+	Application::FrameImage Swapchain::readLastImage() {
+		m_logger.error("Reading back images is only supported for headless Vulkan swapchains");
+		throw Application::SwapchainErrors::ReadbackError();
+	}
+
 	void Swapchain::setVsync(bool useVsync) {
 		m_presentMode = selectPresentMode(useVsync);
 	}
@@ -318,7 +343,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 				.stencilStoreOp = vk::AttachmentStoreOp::eDontCare,
 				.initialLayout  = vk::ImageLayout::eUndefined,
 				.finalLayout    = vk::ImageLayout::ePresentSrcKHR
-			}
+			},
+			m_depthBuffer.getAttachmentDescription()
 		};
 
 		auto attachmentReferences = std::array{
@@ -328,6 +354,11 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			}
 		};
 
+		auto depthAttachmentReference = vk::AttachmentReference{
+			.attachment = 1,
+			.layout     = vk::ImageLayout::eDepthStencilAttachmentOptimal
+		};
+
 		auto subpasses = std::array{
 			vk::SubpassDescription{
 				.flags                   = {},
@@ -337,7 +368,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 				.colorAttachmentCount    = static_cast<uint32_t>(attachmentReferences.size()),
 				.pColorAttachments       = attachmentReferences.data(),
 				.pResolveAttachments     = nullptr,
-				.pDepthStencilAttachment = nullptr,
+				.pDepthStencilAttachment = &depthAttachmentReference,
 				.preserveAttachmentCount = 0,
 				.pPreserveAttachments    = nullptr
 			}
@@ -347,10 +378,14 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 			vk::SubpassDependency{
 				.srcSubpass      = VK_SUBPASS_EXTERNAL,
 				.dstSubpass      = 0,
-				.srcStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput,
-				.dstStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput,
-				.srcAccessMask   = vk::AccessFlags(),
-				.dstAccessMask   = vk::AccessFlagBits::eColorAttachmentWrite,
+				.srcStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput
+					| vk::PipelineStageFlagBits::eLateFragmentTests,
+				.dstStageMask    = vk::PipelineStageFlagBits::eColorAttachmentOutput
+					| vk::PipelineStageFlagBits::eEarlyFragmentTests,
+				.srcAccessMask   = vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+				.dstAccessMask   = vk::AccessFlagBits::eColorAttachmentWrite
+					| vk::AccessFlagBits::eDepthStencilAttachmentRead
+					| vk::AccessFlagBits::eDepthStencilAttachmentWrite,
 				.dependencyFlags = {}
 			}
 		};
@@ -378,13 +413,18 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	}
 
 	vk::raii::Framebuffer Swapchain::createFrameBuffer(const vk::raii::ImageView& imageView) const {
+		auto attachments = std::array{
+			*imageView,
+			*m_depthBuffer.getImageView()
+		};
+
 		try {
 			return m_context.getDevice().createFramebuffer(
 				vk::FramebufferCreateInfo{
 					.flags           = {},
 					.renderPass      = *m_renderPass,
-					.attachmentCount = 1,
-					.pAttachments    = &*imageView,
+					.attachmentCount = static_cast<uint32_t>(attachments.size()),
+					.pAttachments    = attachments.data(),
 					.width           = m_imageExtent.width,
 					.height          = m_imageExtent.height,
 					.layers          = 1
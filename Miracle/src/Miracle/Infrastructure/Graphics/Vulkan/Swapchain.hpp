@@ -3,13 +3,14 @@
 #include <utility>
 #include <vector>
 
-#include <Miracle/Application/Graphics/ISwapchain.hpp>
 #include <Miracle/Application/ILogger.hpp>
 #include "Vulkan.hpp"
+#include "ISwapchain.hpp"
 #include "GraphicsContext.hpp"
+#include "DepthBuffer.hpp"
 
 namespace Miracle::Infrastructure::Graphics::Vulkan {
-	class Swapchain : public Application::ISwapchain {
+	class Swapchain : public ISwapchain {
 	private:
 		Application::ILogger& m_logger;
 		GraphicsContext& m_context;
@@ -20,6 +21,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		vk::PresentModeKHR m_presentMode;
 		vk::raii::SwapchainKHR m_swapchain;
 		std::vector<std::pair<vk::Image, vk::raii::ImageView>> m_images;
+		DepthBuffer m_depthBuffer;
 		vk::raii::RenderPass m_renderPass = nullptr;
 		std::vector<vk::raii::Framebuffer> m_frameBuffers;
 		uint32_t m_imageIndex = 0;
@@ -35,7 +37,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		virtual Application::SwapchainImageSize getImageSize() const override;
 
-		virtual void beginRenderPass(ColorRgb clearColor) override;
+		virtual void beginRenderPass(ColorRgb clearColor, bool useSecondaryCommands) override;
 
 		virtual void endRenderPass() override;
 
@@ -43,6 +45,8 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		virtual void recreate() override;
 
+		virtual Application::FrameImage readLastImage() override;
+
 		virtual bool isUsingVsync() const override {
 			return m_presentMode != vk::PresentModeKHR::eImmediate;
 		}
@@ -55,7 +59,7 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		virtual void setTripleBuffering(bool useTripleBuffering) override;
 
-		const vk::raii::RenderPass& getRenderPass() const { return m_renderPass; }
+		virtual const vk::raii::RenderPass& getRenderPass() const override { return m_renderPass; }
 
 	private:
 		uint32_t selectMinimumImageCount(bool useTripleBuffering) const;
@@ -0,0 +1,255 @@
+#include "UploadBatcher.hpp"
+
+#include <cstring>
+#include <exception>
+#include <format>
+#include <limits>
+
+#include <Miracle/Application/Tracer.hpp>
+#include <Miracle/Application/Graphics/IGraphicsContext.hpp>
+#include "GraphicsContext.hpp"
+#include "BufferUtilities.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	UploadBatcher::UploadBatcher(
+		Application::ILogger& logger,
+		GraphicsContext& context
+	) :
+		m_logger(logger),
+		m_context(context)
+	{
+		try {
+			m_uploadCompletedFence = m_context.getDevice().createFence(
+				vk::FenceCreateInfo{
+					.flags = vk::FenceCreateFlagBits::eSignaled
+				}
+			);
+
+			m_uploadCompletedSemaphore = m_context.getDevice().createSemaphore(
+				vk::SemaphoreCreateInfo{
+					.flags = {}
+				}
+			);
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create synchronization objects for Vulkan upload batcher.\n{}", e.what())
+			);
+
+			throw Application::GraphicsContextErrors::CreationError();
+		}
+
+		m_logger.info("Vulkan upload batcher created");
+	}
+
+	UploadBatcher::~UploadBatcher() {
+		m_logger.info("Destroying Vulkan upload batcher...");
+
+		auto result = m_context.getDevice().waitForFences(
+			*m_uploadCompletedFence,
+			true,
+			std::numeric_limits<uint64_t>::max()
+		);
+
+		if (result == vk::Result::eTimeout) [[unlikely]] {
+			m_logger.warning("Timed out on waiting for Vulkan fence");
+		}
+
+		releaseStagingBuffer();
+	}
+
+	void UploadBatcher::enqueueBufferUpload(
+		vk::Buffer destination,
+		vk::DeviceSize destinationOffset,
+		const void* data,
+		vk::DeviceSize size,
+		vk::PipelineStageFlags destinationStage,
+		vk::AccessFlags destinationAccess
+	) {
+		auto stagingOffset = static_cast<vk::DeviceSize>(m_pendingData.size());
+
+		m_pendingData.resize(m_pendingData.size() + size);
+		std::memcpy(m_pendingData.data() + stagingOffset, data, size);
+
+		m_pendingUploads.push_back(
+			PendingUpload{
+				.destination       = destination,
+				.destinationOffset = destinationOffset,
+				.stagingOffset     = stagingOffset,
+				.size              = size,
+				.destinationStage  = destinationStage,
+				.destinationAccess = destinationAccess
+			}
+		);
+	}
+
+	void UploadBatcher::submitPendingUploads() {
+		if (m_stagingBuffer && m_uploadCompletedFence.getStatus() == vk::Result::eSuccess) {
+			releaseStagingBuffer();
+		}
+
+		if (m_pendingUploads.empty()) [[likely]] return;
+
+		MIRACLE_TRACE_ZONE("UploadBatcher::submitPendingUploads");
+
+		// The previous batch still owns the transfer command buffer until its fence is signaled
+		auto result = m_context.getDevice().waitForFences(
+			*m_uploadCompletedFence,
+			true,
+			std::numeric_limits<uint64_t>::max()
+		);
+
+		if (result == vk::Result::eTimeout) [[unlikely]] {
+			m_logger.warning("Timed out on waiting for Vulkan fence");
+		}
+
+		releaseStagingBuffer();
+
+		try {
+			auto [buffer, allocation] = BufferUtilities::createStagingBuffer(
+				m_context,
+				static_cast<vk::DeviceSize>(m_pendingData.size())
+			);
+
+			m_stagingBuffer = buffer;
+			m_stagingAllocation = allocation;
+		}
+		catch (const std::exception& e) {
+			m_logger.error(
+				std::format("Failed to create staging buffer for Vulkan upload batch.\n{}", e.what())
+			);
+
+			throw Application::GraphicsContextErrors::UploadError();
+		}
+
+		auto stagingBufferData = m_context.getAllocator().getAllocationInfo(m_stagingAllocation).pMappedData;
+		std::memcpy(stagingBufferData, m_pendingData.data(), m_pendingData.size());
+		m_context.getAllocator().flushAllocation(m_stagingAllocation, 0, m_pendingData.size());
+
+		auto& queueFamilyIndices = m_context.getDeviceInfo().queueFamilyIndices;
+		auto transferFamilyIndex = queueFamilyIndices.transferFamilyIndex.value();
+		auto graphicsFamilyIndex = queueFamilyIndices.graphicsFamilyIndex.value();
+		bool isOwnershipTransferRequired = transferFamilyIndex != graphicsFamilyIndex;
+
+		auto releaseBarriers = std::vector<vk::BufferMemoryBarrier>();
+		m_uploadCompletedWaitStage = {};
+
+		for (auto& upload : m_pendingUploads) {
+			m_uploadCompletedWaitStage |= upload.destinationStage;
+
+			if (!isOwnershipTransferRequired) continue;
+
+			releaseBarriers.push_back(
+				vk::BufferMemoryBarrier{
+					.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+					.dstAccessMask       = {},
+					.srcQueueFamilyIndex = transferFamilyIndex,
+					.dstQueueFamilyIndex = graphicsFamilyIndex,
+					.buffer              = upload.destination,
+					.offset              = upload.destinationOffset,
+					.size                = upload.size
+				}
+			);
+
+			m_pendingAcquireBarriers.push_back(
+				vk::BufferMemoryBarrier{
+					.srcAccessMask       = {},
+					.dstAccessMask       = upload.destinationAccess,
+					.srcQueueFamilyIndex = transferFamilyIndex,
+					.dstQueueFamilyIndex = graphicsFamilyIndex,
+					.buffer              = upload.destination,
+					.offset              = upload.destinationOffset,
+					.size                = upload.size
+				}
+			);
+		}
+
+		m_context.recordTransferCommands(
+			[&]() {
+				auto& commandBuffer = m_context.getTransferCommandBuffer();
+
+				for (auto& upload : m_pendingUploads) {
+					commandBuffer.copyBuffer(
+						m_stagingBuffer,
+						upload.destination,
+						vk::BufferCopy{
+							.srcOffset = upload.stagingOffset,
+							.dstOffset = upload.destinationOffset,
+							.size      = upload.size
+						}
+					);
+				}
+
+				if (!releaseBarriers.empty()) {
+					commandBuffer.pipelineBarrier(
+						vk::PipelineStageFlagBits::eTransfer,
+						vk::PipelineStageFlagBits::eBottomOfPipe,
+						{},
+						{},
+						releaseBarriers,
+						{}
+					);
+				}
+			}
+		);
+
+		m_context.getDevice().resetFences(*m_uploadCompletedFence);
+
+		m_context.getTransferQueue().submit(
+			vk::SubmitInfo{
+				.waitSemaphoreCount   = 0,
+				.pWaitSemaphores      = nullptr,
+				.pWaitDstStageMask    = {},
+				.commandBufferCount   = 1,
+				.pCommandBuffers      = &*m_context.getTransferCommandBuffer(),
+				.signalSemaphoreCount = 1,
+				.pSignalSemaphores    = &*m_uploadCompletedSemaphore
+			},
+			*m_uploadCompletedFence
+		);
+
+		m_uploadCompletedSemaphoreSignaled = true;
+
+		m_logger.info(
+			std::format(
+				"Vulkan upload batch submitted: {} copies, {} bytes",
+				m_pendingUploads.size(),
+				m_pendingData.size()
+			)
+		);
+
+		m_pendingUploads.clear();
+		m_pendingData.clear();
+	}
+
+	void UploadBatcher::recordAcquireBarriers() {
+		if (m_pendingAcquireBarriers.empty()) [[likely]] return;
+
+		m_context.getGraphicsCommandBuffer().pipelineBarrier(
+			m_uploadCompletedWaitStage,
+			m_uploadCompletedWaitStage,
+			{},
+			{},
+			m_pendingAcquireBarriers,
+			{}
+		);
+
+		m_pendingAcquireBarriers.clear();
+	}
+
+	std::optional<std::pair<vk::Semaphore, vk::PipelineStageFlags>> UploadBatcher::takeUploadCompletedWait() {
+		if (!m_uploadCompletedSemaphoreSignaled) [[likely]] return std::nullopt;
+
+		m_uploadCompletedSemaphoreSignaled = false;
+
+		return std::pair(*m_uploadCompletedSemaphore, m_uploadCompletedWaitStage);
+	}
+
+	void UploadBatcher::releaseStagingBuffer() {
+		if (!m_stagingBuffer) return;
+
+		m_context.getAllocator().destroyBuffer(m_stagingBuffer, m_stagingAllocation);
+		m_stagingBuffer = nullptr;
+		m_stagingAllocation = nullptr;
+	}
+}
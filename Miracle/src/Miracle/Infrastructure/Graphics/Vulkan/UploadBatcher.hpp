@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <Miracle/Application/ILogger.hpp>
+#include "Vulkan.hpp"
+#include "Vma.hpp"
+
+namespace Miracle::Infrastructure::Graphics::Vulkan {
+	class GraphicsContext;
+
+	// Collects buffer uploads and submits them as a single transfer per frame, without blocking the host
+	class UploadBatcher {
+	private:
+		struct PendingUpload {
+			vk::Buffer destination = nullptr;
+			vk::DeviceSize destinationOffset = 0;
+			vk::DeviceSize stagingOffset = 0;
+			vk::DeviceSize size = 0;
+			vk::PipelineStageFlags destinationStage = {};
+			vk::AccessFlags destinationAccess = {};
+		};
+
+		Application::ILogger& m_logger;
+		GraphicsContext& m_context;
+
+		std::vector<std::byte> m_pendingData;
+		std::vector<PendingUpload> m_pendingUploads;
+		std::vector<vk::BufferMemoryBarrier> m_pendingAcquireBarriers;
+
+		vk::raii::Fence m_uploadCompletedFence = nullptr;
+		vk::raii::Semaphore m_uploadCompletedSemaphore = nullptr;
+		bool m_uploadCompletedSemaphoreSignaled = false;
+		vk::PipelineStageFlags m_uploadCompletedWaitStage = {};
+		vk::Buffer m_stagingBuffer = nullptr;
+		vma::Allocation m_stagingAllocation = nullptr;
+
+	public:
+		UploadBatcher(
+			Application::ILogger& logger,
+			GraphicsContext& context
+		);
+
+		~UploadBatcher();
+
+		bool hasPendingUploads() const { return !m_pendingUploads.empty(); }
+
+		void enqueueBufferUpload(
+			vk::Buffer destination,
+			vk::DeviceSize destinationOffset,
+			const void* data,
+			vk::DeviceSize size,
+			vk::PipelineStageFlags destinationStage,
+			vk::AccessFlags destinationAccess
+		);
+
+		// Must be called before graphics recording begins
+		void submitPendingUploads();
+
+		// Graphics command
+		void recordAcquireBarriers();
+
+		// Returns the semaphore the next graphics submission has to wait on, along with the stage to wait at
+		std::optional<std::pair<vk::Semaphore, vk::PipelineStageFlags>> takeUploadCompletedWait();
+
+	private:
+		void releaseStagingBuffer();
+	};
+}
@@ -9,39 +9,17 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 	VertexBuffer::VertexBuffer(
 		Application::ILogger& logger,
 		GraphicsContext& context,
-		const std::vector<Vertex>& vertices
+		uint32_t vertexCapacity
 	) :
 		m_logger(logger),
 		m_context(context)
 	{
-		if (vertices.empty()) {
-			m_logger.error("No vertices provided for Vulkan vertex buffer creation");
+		if (vertexCapacity == 0) {
+			m_logger.error("No vertex capacity provided for Vulkan vertex buffer creation");
 			throw Application::VertexBufferErrors::NoVerticesProvidedError();
 		}
 
-		auto requiredBufferSize = static_cast<vk::DeviceSize>(sizeof(vertices.front()) * vertices.size());
-
-		auto [stagingBuffer, stagingAllocation] = std::pair<vk::Buffer, vma::Allocation>();
-
-		try {
-			auto [buffer, allocation] = BufferUtilities::createStagingBuffer(
-				m_context,
-				requiredBufferSize
-			);
-
-			stagingBuffer = buffer;
-			stagingAllocation = allocation;
-		}
-		catch (const std::exception& e) {
-			m_logger.error(
-				std::format("Failed to create staging buffer for Vulkan vertex buffer.\n{}", e.what())
-			);
-
-			throw Application::VertexBufferErrors::CreationError();
-		}
-
-		auto stagingBufferData = m_context.getAllocator().getAllocationInfo(stagingAllocation).pMappedData;
-		std::memcpy(stagingBufferData, vertices.data(), requiredBufferSize);
+		auto requiredBufferSize = static_cast<vk::DeviceSize>(sizeof(Vertex) * vertexCapacity);
 
 		try {
 			auto [buffer, allocation] = BufferUtilities::createBuffer(
@@ -58,15 +36,10 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 				std::format("Failed to create Vulkan vertex buffer.\n{}", e.what())
 			);
 
-			m_context.getAllocator().destroyBuffer(stagingBuffer, stagingAllocation);
 			throw Application::VertexBufferErrors::CreationError();
 		}
 
-		BufferUtilities::copyBuffer(m_context, m_buffer, stagingBuffer, requiredBufferSize);
-
-		m_context.getAllocator().destroyBuffer(stagingBuffer, stagingAllocation);
-
-		m_vertexCount = vertices.size();
+		m_vertexCapacity = vertexCapacity;
 
 		m_logger.info("Vulkan vertex buffer created");
 	}
@@ -77,6 +50,17 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 		m_context.getAllocator().destroyBuffer(m_buffer, m_allocation);
 	}
 
+	void VertexBuffer::write(uint32_t firstVertex, std::span<const Vertex> vertices) {
+		m_context.getUploadBatcher().enqueueBufferUpload(
+			m_buffer,
+			static_cast<vk::DeviceSize>(sizeof(Vertex) * firstVertex),
+			vertices.data(),
+			static_cast<vk::DeviceSize>(vertices.size_bytes()),
+			vk::PipelineStageFlagBits::eVertexInput,
+			vk::AccessFlagBits::eVertexAttributeRead
+		);
+	}
+
 	void VertexBuffer::bind() {
 		m_context.getGraphicsCommandBuffer().bindVertexBuffers(0, m_buffer, {0});
 	}
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include <Miracle/Common/Models/Vertex.hpp>
 #include <Miracle/Application/ILogger.hpp>
@@ -17,18 +17,20 @@ namespace Miracle::Infrastructure::Graphics::Vulkan {
 
 		vk::Buffer m_buffer = nullptr;
 		vma::Allocation m_allocation = nullptr;
-		uint32_t m_vertexCount = 0;
+		uint32_t m_vertexCapacity = 0;
 
 	public:
 		VertexBuffer(
 			Application::ILogger& logger,
 			GraphicsContext& context,
-			const std::vector<Vertex>& vertices
+			uint32_t vertexCapacity
 		);
 
 		~VertexBuffer();
 
-		virtual uint32_t getVertexCount() const override { return m_vertexCount; }
+		virtual uint32_t getVertexCapacity() const override { return m_vertexCapacity; }
+
+		virtual void write(uint32_t firstVertex, std::span<const Vertex> vertices) override;
 
 		virtual void bind() override;
 	};
@@ -9,6 +9,10 @@ namespace Miracle::Infrastructure::Persistance::FileSystem {
 		m_logger(logger)
 	{}
 
+	bool FileAccess::fileExists(const std::filesystem::path& filePath) const {
+		return std::filesystem::exists(filePath);
+	}
+
 	std::vector<std::byte> FileAccess::readFileAsBinary(const std::filesystem::path& filePath) const {
 		if (!std::filesystem::exists(filePath)) [[unlikely]] {
 			m_logger.error(std::format("Could not find file {}", filePath.string()));
@@ -30,4 +34,31 @@ namespace Miracle::Infrastructure::Persistance::FileSystem {
 
 		return buffer;
 	}
+
+	void FileAccess::writeFileAsBinary(
+		const std::filesystem::path& filePath,
+		std::span<const std::byte> data
+	) const {
+		auto fileStream = std::basic_ofstream<std::byte>(
+			filePath,
+			std::ofstream::binary | std::ofstream::trunc
+		);
+
+		if (!fileStream.is_open()) [[unlikely]] {
+			m_logger.error(std::format("Failed to open file {} for writing", filePath.string()));
+			throw Application::FileAccessErrors::UnableToOpenFileError(filePath);
+		}
+
+		fileStream.write(data.data(), data.size());
+		fileStream.close();
+
+		// A short write, such as on a full disk, would otherwise leave a truncated file that looks complete
+		if (!fileStream) [[unlikely]] {
+			auto errorCode = std::error_code();
+			std::filesystem::remove(filePath, errorCode);
+
+			m_logger.error(std::format("Failed to write file {}", filePath.string()));
+			throw Application::FileAccessErrors::UnableToWriteFileError(filePath);
+		}
+	}
 }
@@ -11,6 +11,13 @@ namespace Miracle::Infrastructure::Persistance::FileSystem {
 	public:
 		FileAccess(Application::ILogger& logger);
 
+		virtual bool fileExists(const std::filesystem::path& filePath) const override;
+
 		virtual std::vector<std::byte> readFileAsBinary(const std::filesystem::path& filePath) const override;
+
+		virtual void writeFileAsBinary(
+			const std::filesystem::path& filePath,
+			std::span<const std::byte> data
+		) const override;
 	};
 }
@@ -62,6 +62,8 @@ namespace Miracle::Infrastructure::View::Glfw {
 
 		virtual void setSize(WindowSize size) override;
 
+		virtual bool isHeadless() const override { return false; }
+
 		virtual std::span<const char*> getRequiredVulkanExtensionNames() const override;
 
 		virtual vk::raii::SurfaceKHR createVulkanSurface(
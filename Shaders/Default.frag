@@ -1,5 +1,8 @@
 #version 450
 
+// Shading permutation chosen per material: 0 is flat, 1 darkens with depth
+layout(constant_id = 0) const uint shadingMode = 0;
+
 layout(location = 0) out vec4 outColor;
 
 layout(push_constant) uniform PushConstants {
@@ -7,5 +10,10 @@ layout(push_constant) uniform PushConstants {
 } constants;
 
 void main() {
-	outColor = vec4(constants.color, 1.0);
+	if (shadingMode == 1) {
+		outColor = vec4(constants.color * (1.0 - gl_FragCoord.z), 1.0);
+	}
+	else {
+		outColor = vec4(constants.color, 1.0);
+	}
 }
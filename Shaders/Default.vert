@@ -2,6 +2,9 @@
 
 layout(location = 0) in vec3 position;
 
+// The depth pre-pass and shading pipelines run this shader separately, and have to agree on depth exactly
+invariant gl_Position;
+
 layout(push_constant) uniform PushConstants {
 	mat4 transform;
 } constants;
@@ -0,0 +1,23 @@
+#version 450
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec4 transformRow1;
+layout(location = 2) in vec4 transformRow2;
+layout(location = 3) in vec4 transformRow3;
+layout(location = 4) in vec4 transformRow4;
+layout(location = 5) in vec3 color;
+
+layout(location = 0) out vec3 fragmentColor;
+
+layout(push_constant) uniform PushConstants {
+	mat4 viewProjection;
+} constants;
+
+void main() {
+	mat4 transform = mat4(transformRow1, transformRow2, transformRow3, transformRow4);
+
+	gl_Position = (transform * vec4(position, 1.0)) * constants.viewProjection;
+	gl_Position.y *= -1.0;
+
+	fragmentColor = color;
+}